@@ -0,0 +1,86 @@
+/*
+ * BenchmarkWorlds.h
+ */
+
+#pragma once
+
+#include "dynamics/PhysicsWorld.h"
+#include "dynamics/PhysicsBody.h"
+#include "dynamics/environment/Atmosphere.h"
+#include "dynamics/environment/Geographic.h"
+#include "dynamics/environment/Humidity.h"
+#include "dynamics/environment/Wind.h"
+#include "dynamics/forces/Coriolis.h"
+#include "dynamics/forces/Gravity.h"
+#include "dynamics/forces/SpinDecay.h"
+#include "dynamics/forces/SpinDrift.h"
+#include "dynamics/forces/drag/Drag.h"
+#include "math/Angles.h"
+
+#include <memory>
+
+namespace BulletPhysics {
+namespace benchmarks {
+
+// gravity only, isolates integrator overhead
+inline void setupGravityWorld(dynamics::PhysicsWorld& world)
+{
+    world.addForce(std::make_unique<dynamics::forces::Gravity>());
+}
+
+// gravity and aerodynamic drag only
+inline void setupBasicWorld(dynamics::PhysicsWorld& world)
+{
+    world.addEnvironment(std::make_unique<dynamics::environment::Atmosphere>());
+    world.addForce(std::make_unique<dynamics::forces::Gravity>());
+    world.addForce(std::make_unique<dynamics::forces::drag::Drag>());
+}
+
+// every environment and force the library provides
+inline void setupFullWorld(dynamics::PhysicsWorld& world)
+{
+    world.addEnvironment(std::make_unique<dynamics::environment::Atmosphere>());
+    world.addEnvironment(std::make_unique<dynamics::environment::Humidity>(60.0f));
+    world.addEnvironment(std::make_unique<dynamics::environment::Wind>(math::Vec3{2.0f, 0.0f, 1.0f}));
+    world.addEnvironment(std::make_unique<dynamics::environment::Geographic>(math::deg2rad(48.15f), math::deg2rad(17.11f)));
+
+    world.addForce(std::make_unique<dynamics::forces::Gravity>());
+    world.addForce(std::make_unique<dynamics::forces::drag::Drag>());
+    world.addForce(std::make_unique<dynamics::forces::Coriolis>());
+    dynamics::forces::SpinDrift::addTo(world);
+    world.addForce(std::make_unique<dynamics::forces::SpinDecay>());
+}
+
+// 7.62x51 mm 175 gr match round
+inline dynamics::projectile::ProjectileSpecs rifleSpecs()
+{
+    dynamics::projectile::ProjectileSpecs specs{0.01134f};
+    specs.diameter = 0.00782f;
+    specs.dragModel = dynamics::forces::drag::DragCurveModel::G7;
+
+    dynamics::projectile::SpinSpecs spin;
+    spin.riflingSpecs = dynamics::projectile::RiflingSpecs{dynamics::projectile::RiflingSpecs::Direction::RIGHT, 32.0f};
+    specs.spinSpecs = spin;
+
+    return specs;
+}
+
+inline dynamics::projectile::ProjectileRigidBody makeRifleBody()
+{
+    dynamics::projectile::ProjectileRigidBody body(rifleSpecs());
+    body.setPosition({0.0f, 1.5f, 0.0f});
+    body.setVelocityFromAngles(790.0f, 0.5f, 0.0f);
+    return body;
+}
+
+// same round with attitude and spin state
+inline dynamics::projectile::ProjectileRigidBody6DOF makeRifleBody6DOF()
+{
+    dynamics::projectile::ProjectileRigidBody6DOF body(rifleSpecs());
+    body.setPosition({0.0f, 1.5f, 0.0f});
+    body.setVelocityFromAngles(790.0f, 0.5f, 0.0f);
+    return body;
+}
+
+} // namespace benchmarks
+} // namespace BulletPhysics
@@ -0,0 +1,134 @@
+/*
+ * BodyPoolBenchmark.cpp
+ */
+
+#include "BenchmarkWorlds.h"
+#include "dynamics/BodyPool.h"
+#include "math/Integrator.h"
+
+#include <benchmark/benchmark.h>
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+using namespace BulletPhysics;
+using namespace BulletPhysics::dynamics;
+
+namespace {
+
+using Round = projectile::ProjectileRigidBody;
+
+// 100k rounds per second at 60 Hz, each lives 1 s, so 100k are alive at any time
+constexpr size_t SPAWNS_PER_TICK = 100000 / 60;
+constexpr size_t LIFETIME_TICKS = 60;
+
+Round makeRound()
+{
+    return benchmarks::makeRifleBody();
+}
+
+} // namespace
+
+// one tick of churn: spawn new rounds, despawn those whose lifetime ended (handles checked first)
+static void BM_BodyPool_Churn(benchmark::State& state)
+{
+    BodyStorage<Round> pool;
+    std::deque<BodyHandle<Round>> alive;
+    const Round prototype = makeRound();
+
+    for (size_t i = 0; i < SPAWNS_PER_TICK * LIFETIME_TICKS; i++)
+    {
+        alive.push_back(pool.spawn(prototype));
+    }
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < SPAWNS_PER_TICK; i++)
+        {
+            pool.despawn(alive.front());
+            alive.pop_front();
+            alive.push_back(pool.spawn(prototype));
+        }
+        benchmark::DoNotOptimize(pool.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * SPAWNS_PER_TICK);
+}
+BENCHMARK(BM_BodyPool_Churn)->Unit(benchmark::kMicrosecond);
+
+// same churn with bodies owned by unique_ptr, for comparison
+static void BM_HeapBodies_Churn(benchmark::State& state)
+{
+    std::deque<std::unique_ptr<Round>> alive;
+    const Round prototype = makeRound();
+
+    for (size_t i = 0; i < SPAWNS_PER_TICK * LIFETIME_TICKS; i++)
+    {
+        alive.push_back(std::make_unique<Round>(prototype));
+    }
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < SPAWNS_PER_TICK; i++)
+        {
+            alive.pop_front();
+            alive.push_back(std::make_unique<Round>(prototype));
+        }
+        benchmark::DoNotOptimize(alive.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * SPAWNS_PER_TICK);
+}
+BENCHMARK(BM_HeapBodies_Churn)->Unit(benchmark::kMicrosecond);
+
+// Euler step of whole population in gravity world, pooled bodies are visited in dense order
+static void BM_BodyPool_Step(benchmark::State& state)
+{
+    PhysicsWorld world;
+    benchmarks::setupGravityWorld(world);
+    math::EulerIntegrator integrator;
+
+    BodyStorage<Round> pool;
+    const Round prototype = makeRound();
+    for (int64_t i = 0; i < state.range(0); i++)
+    {
+        pool.spawn(prototype);
+    }
+
+    for (auto _ : state)
+    {
+        pool.forEach([&](Round& body) { integrator.step(body, &world, 0.001f); });
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BodyPool_Step)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+// same step over unique_ptr bodies allocated interleaved with other allocations, as after long churn
+static void BM_HeapBodies_Step(benchmark::State& state)
+{
+    PhysicsWorld world;
+    benchmarks::setupGravityWorld(world);
+    math::EulerIntegrator integrator;
+
+    std::vector<std::unique_ptr<Round>> bodies;
+    std::vector<std::unique_ptr<char[]>> noise;
+    const Round prototype = makeRound();
+    for (int64_t i = 0; i < state.range(0); i++)
+    {
+        bodies.push_back(std::make_unique<Round>(prototype));
+        noise.push_back(std::make_unique<char[]>(96));
+    }
+
+    for (auto _ : state)
+    {
+        for (auto& body : bodies)
+        {
+            integrator.step(*body, &world, 0.001f);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_HeapBodies_Step)->Arg(100000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,170 @@
+/*
+ * CollisionBenchmark.cpp
+ */
+
+#include "collision/BoxCollider.h"
+#include "collision/CapsuleCollider.h"
+#include "collision/CollisionDetection.h"
+#include "collision/GroundCollider.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace BulletPhysics;
+using namespace BulletPhysics::collision;
+
+namespace {
+
+// boxes scattered over a square field with one ground plane, fixed seed for repeatable pair sets
+struct Scene {
+    GroundCollider ground{0.0f};
+    std::vector<std::unique_ptr<BoxCollider>> boxes;
+    CollisionDetection detection;
+    float fieldSize = 0.0f;
+
+    Scene(size_t count, bool broadphase)
+    {
+        fieldSize = 10.0f * std::sqrt(static_cast<float>(count));
+
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> coord(0.0f, fieldSize);
+        std::uniform_real_distribution<float> height(0.0f, 5.0f);
+
+        detection.setBroadphaseEnabled(broadphase);
+        detection.addCollider(&ground);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            auto box = std::make_unique<BoxCollider>(math::Vec3{2.0f, 2.0f, 2.0f});
+            box->setPosition({coord(rng), height(rng), coord(rng)});
+            detection.addCollider(box.get());
+            boxes.push_back(std::move(box));
+        }
+    }
+};
+
+void runDetect(benchmark::State& state, bool broadphase, size_t threads = 1)
+{
+    const size_t count = static_cast<size_t>(state.range(0));
+    Scene scene(count, broadphase);
+    scene.detection.setThreadCount(threads);
+
+    std::vector<Manifold> manifolds;
+    for (auto _ : state)
+    {
+        scene.detection.detect(manifolds);
+        benchmark::DoNotOptimize(manifolds.data());
+    }
+
+    // candidate pairs handed to narrowphase per detect (all-pairs includes ground)
+    const size_t pairs = broadphase ? scene.detection.getBroadphase().getPairs().size() : (count + 1) * count / 2;
+
+    state.counters["colliders"] = static_cast<double>(count);
+    state.counters["manifolds"] = static_cast<double>(manifolds.size());
+    state.counters["pairs"] = benchmark::Counter(static_cast<double>(pairs) * static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+}
+
+// one projectile step (1 m segment) per query across the field
+void runSweep(benchmark::State& state, bool broadphase)
+{
+    const size_t count = static_cast<size_t>(state.range(0));
+    Scene scene(count, broadphase);
+
+    std::vector<Manifold> manifolds;
+    scene.detection.detect(manifolds);
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> coord(0.0f, scene.fieldSize);
+
+    std::vector<math::Vec3> starts(1024);
+    for (auto& start : starts)
+    {
+        start = {coord(rng), 1.5f, coord(rng)};
+    }
+
+    size_t i = 0;
+    SweepHit hit;
+    for (auto _ : state)
+    {
+        const math::Vec3& start = starts[i++ & 1023];
+        benchmark::DoNotOptimize(scene.detection.sweep(start, start + math::Vec3{0.0f, -0.01f, 1.0f}, hit));
+    }
+
+    state.counters["colliders"] = static_cast<double>(count);
+}
+
+} // namespace
+
+static void BM_CollisionDetection_Detect(benchmark::State& state) { runDetect(state, false); }
+static void BM_CollisionDetection_DetectBroadphase(benchmark::State& state) { runDetect(state, true); }
+
+BENCHMARK(BM_CollisionDetection_Detect)->RangeMultiplier(4)->Range(16, 4096)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CollisionDetection_DetectBroadphase)->RangeMultiplier(10)->Range(100, 100000)->Unit(benchmark::kMicrosecond);
+
+// thread scaling of narrowphase, args are (colliders, threads), wall time since work runs off the main thread
+static void BM_CollisionDetection_DetectParallel(benchmark::State& state)
+{
+    runDetect(state, false, static_cast<size_t>(state.range(1)));
+    state.counters["threads"] = static_cast<double>(state.range(1));
+}
+static void BM_CollisionDetection_DetectBroadphaseParallel(benchmark::State& state)
+{
+    runDetect(state, true, static_cast<size_t>(state.range(1)));
+    state.counters["threads"] = static_cast<double>(state.range(1));
+}
+
+static void threadScaling(benchmark::internal::Benchmark* benchmark, int64_t colliders)
+{
+    const int64_t maxThreads = std::max<int64_t>(4, std::thread::hardware_concurrency());
+    for (int64_t threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        benchmark->Args({colliders, threads});
+    }
+}
+
+BENCHMARK(BM_CollisionDetection_DetectParallel)->Apply([](auto* b) { threadScaling(b, 4096); })->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CollisionDetection_DetectBroadphaseParallel)->Apply([](auto* b) { threadScaling(b, 100000); })->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+// people-sized capsule targets standing on ground, about 10 m apart with occasional groups touching
+static void BM_CollisionDetection_DetectCapsules(benchmark::State& state)
+{
+    const size_t count = static_cast<size_t>(state.range(0));
+    const float fieldSize = 10.0f * std::sqrt(static_cast<float>(count));
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> coord(0.0f, fieldSize);
+
+    GroundCollider ground{0.0f};
+    std::vector<CapsuleCollider> targets(count, CapsuleCollider{0.3f, 1.8f});
+
+    CollisionDetection detection;
+    detection.addCollider(&ground);
+    for (CapsuleCollider& target : targets)
+    {
+        target.setPosition({coord(rng), 0.9f, coord(rng)});
+        detection.addCollider(&target);
+    }
+
+    std::vector<Manifold> manifolds;
+    for (auto _ : state)
+    {
+        detection.detect(manifolds);
+        benchmark::DoNotOptimize(manifolds.data());
+    }
+
+    state.counters["colliders"] = static_cast<double>(count);
+    state.counters["manifolds"] = static_cast<double>(manifolds.size());
+}
+BENCHMARK(BM_CollisionDetection_DetectCapsules)->RangeMultiplier(10)->Range(100, 10000)->Unit(benchmark::kMicrosecond);
+
+static void BM_CollisionDetection_Sweep(benchmark::State& state) { runSweep(state, false); }
+static void BM_CollisionDetection_SweepBroadphase(benchmark::State& state) { runSweep(state, true); }
+
+BENCHMARK(BM_CollisionDetection_Sweep)->RangeMultiplier(10)->Range(100, 10000);
+BENCHMARK(BM_CollisionDetection_SweepBroadphase)->RangeMultiplier(10)->Range(100, 100000);
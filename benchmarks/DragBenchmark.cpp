@@ -0,0 +1,106 @@
+/*
+ * DragBenchmark.cpp
+ */
+
+#include "dynamics/forces/drag/DragModel.h"
+#include "dynamics/forces/drag/DragTable.h"
+#include "dynamics/forces/drag/MachReynoldsTable.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+using namespace BulletPhysics::dynamics::forces::drag;
+
+// interpolated lookup sweeping the whole Mach range of the table
+static void BM_DragCurve_GetCd(benchmark::State& state)
+{
+    DragCurve curve;
+    curve.loadFromFile(DRAG_CURVE_G7);
+
+    float mach = 0.0f;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(curve.getCd(mach));
+        mach += 0.01f;
+        if (mach > 5.0f)
+        {
+            mach = 0.0f;
+        }
+    }
+}
+BENCHMARK(BM_DragCurve_GetCd);
+
+static void BM_DragCurve_GetCdNearest(benchmark::State& state)
+{
+    DragCurve curve;
+    curve.loadFromFile(DRAG_CURVE_G7);
+
+    float mach = 0.0f;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(curve.getCdNearest(mach));
+        mach += 0.01f;
+        if (mach > 5.0f)
+        {
+            mach = 0.0f;
+        }
+    }
+}
+BENCHMARK(BM_DragCurve_GetCdNearest);
+
+// per-load table as sampled at intern, compare with BM_DragCurve_GetCd
+static void BM_DragTable_At(benchmark::State& state)
+{
+    DragCurve curve;
+    curve.loadFromFile(DRAG_CURVE_G7);
+    const DragTable table = DragTable::sample([&](float mach) { return curve.getCd(mach); });
+
+    float mach = 0.0f;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(table.at(mach));
+        mach += 0.01f;
+        if (mach > 5.0f)
+        {
+            mach = 0.0f;
+        }
+    }
+}
+BENCHMARK(BM_DragTable_At);
+
+// 2D lookup with Re sweeping 1e4..1e7, compare with BM_DragTable_At
+static void BM_MachReynoldsTable_At(benchmark::State& state)
+{
+    DragCurve curve;
+    curve.loadFromFile(DRAG_CURVE_G7);
+    const MachReynoldsTable table = MachReynoldsTable::sample(0.0f, 5.0f, 1e4f, 1e7f, [&](float mach, float reynolds)
+    {
+        return curve.getCd(mach) * (1.0f + 10.0f / std::sqrt(reynolds));
+    });
+
+    float mach = 0.0f;
+    float reynolds = 1e4f;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(table.at(mach, reynolds));
+        mach += 0.01f;
+        reynolds *= 1.013f;
+        if (mach > 5.0f)
+        {
+            mach = 0.0f;
+            reynolds = 1e4f;
+        }
+    }
+}
+BENCHMARK(BM_MachReynoldsTable_At);
+
+static void BM_StandardDragModel_Construct(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        StandardDragModel model(DragCurveModel::G1);
+        benchmark::DoNotOptimize(model);
+    }
+}
+BENCHMARK(BM_StandardDragModel_Construct);
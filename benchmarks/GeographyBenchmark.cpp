@@ -0,0 +1,44 @@
+/*
+ * GeographyBenchmark.cpp
+ */
+
+#include "geography/Coordinates.h"
+#include "math/Angles.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace BulletPhysics;
+using namespace BulletPhysics::geography;
+
+static void BM_GeodeticToECEF(benchmark::State& state)
+{
+    GeographicPosition position(math::deg2rad(48.15f), math::deg2rad(17.11f), 150.0);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(position);
+        benchmark::DoNotOptimize(geodeticToECEF(position));
+    }
+}
+BENCHMARK(BM_GeodeticToECEF);
+
+static void BM_ECEFToGeodetic(benchmark::State& state)
+{
+    ECEFPosition position = geodeticToECEF(GeographicPosition(math::deg2rad(48.15f), math::deg2rad(17.11f), 150.0));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(position);
+        benchmark::DoNotOptimize(ecefToGeodetic(position));
+    }
+}
+BENCHMARK(BM_ECEFToGeodetic);
+
+static void BM_GravitationalAccelerationAtGeodetic(benchmark::State& state)
+{
+    GeographicPosition position(math::deg2rad(48.15f), math::deg2rad(17.11f), 150.0);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(position);
+        benchmark::DoNotOptimize(gravitationalAccelerationAtGeodetic(position));
+    }
+}
+BENCHMARK(BM_GravitationalAccelerationAtGeodetic);
@@ -0,0 +1,101 @@
+/*
+ * HeightfieldBenchmark.cpp
+ */
+
+#include "collision/HeightfieldCollider.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace BulletPhysics;
+using namespace BulletPhysics::collision;
+
+namespace {
+
+// rolling hills with noise, size x size samples at 1 m spacing
+std::vector<float> makeTerrain(size_t size)
+{
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> noise(-0.5f, 0.5f);
+
+    std::vector<float> heights(size * size);
+    for (size_t j = 0; j < size; j++)
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            heights[j * size + i] = 20.0f * std::sin(0.02f * static_cast<float>(i)) * std::cos(0.03f * static_cast<float>(j)) + noise(rng);
+        }
+    }
+
+    return heights;
+}
+
+// flat shots across whole grid above hills, ending in ground at far side
+std::vector<math::Vec3> makeShots(size_t size, size_t count)
+{
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+    const float extent = static_cast<float>(size - 1);
+
+    std::vector<math::Vec3> points;
+    points.reserve(count * 2);
+    for (size_t i = 0; i < count; i++)
+    {
+        points.push_back({0.5f, 25.0f, extent * unit(rng)});
+        points.push_back({extent - 0.5f, -25.0f, extent * unit(rng)});
+    }
+
+    return points;
+}
+
+} // namespace
+
+// segment spans the whole grid, pyramid skips the part above terrain so cost grows well below linear in size
+static void BM_HeightfieldCollider_TestSegment(benchmark::State& state)
+{
+    const size_t size = static_cast<size_t>(state.range(0));
+
+    HeightfieldCollider terrain(size, size, 1.0f, makeTerrain(size));
+    std::vector<math::Vec3> shots = makeShots(size, 256);
+
+    size_t i = 0;
+    SweepInfo info;
+    for (auto _ : state)
+    {
+        const size_t shot = (i++ & 255) * 2;
+        benchmark::DoNotOptimize(terrain.testSegment(shots[shot], shots[shot + 1], info));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_HeightfieldCollider_TestSegment)->RangeMultiplier(4)->Range(64, 4096);
+
+static void BM_HeightfieldCollider_GetHeight(benchmark::State& state)
+{
+    const size_t size = 1024;
+
+    HeightfieldCollider terrain(size, size, 1.0f, makeTerrain(size));
+
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> coord(0.0f, static_cast<float>(size - 1));
+    std::vector<float> coords(2048);
+    for (float& c : coords)
+    {
+        c = coord(rng);
+    }
+
+    size_t i = 0;
+    float height = 0.0f;
+    for (auto _ : state)
+    {
+        const size_t k = (i++ & 1023) * 2;
+        benchmark::DoNotOptimize(terrain.getHeight(coords[k], coords[k + 1], height));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_HeightfieldCollider_GetHeight);
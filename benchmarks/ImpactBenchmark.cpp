@@ -0,0 +1,87 @@
+/*
+ * ImpactBenchmark.cpp
+ */
+
+#include "BenchmarkWorlds.h"
+
+#include "collision/BoxCollider.h"
+#include "collision/GroundCollider.h"
+#include "collision/SphereCollider.h"
+#include "dynamics/ImpactResponse.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace BulletPhysics;
+using namespace BulletPhysics::collision;
+using namespace BulletPhysics::dynamics;
+
+// rifle rounds hitting ground (soil) and thin steel plates at random angles, shallow ones ricochet,
+// velocities are restored every frame since response changes them (restore is included in timing)
+static void BM_ImpactResponse_Resolve(benchmark::State& state)
+{
+    const size_t count = static_cast<size_t>(state.range(0));
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> angle(0.02f, 1.5f);
+    std::uniform_real_distribution<float> speed(300.0f, 850.0f);
+
+    GroundCollider ground{0.0f};
+    ground.setMaterial(materials::SOIL);
+
+    BoxCollider plate({1.0f, 1.0f, 0.01f});
+    Material armor = materials::STEEL;
+    armor.thickness = 0.01f;
+    plate.setMaterial(armor);
+
+    std::vector<projectile::ProjectileRigidBody> bodies(count, projectile::ProjectileRigidBody{benchmarks::rifleSpecs()});
+    std::vector<SphereCollider> colliders(count, SphereCollider{0.004f});
+    std::vector<math::Vec3> velocities(count);
+    std::vector<Manifold> manifolds(count);
+
+    ImpactResponse response;
+    for (size_t i = 0; i < count; i++)
+    {
+        // ids 0 and 1 are targets
+        const uint32_t id = static_cast<uint32_t>(i + 2);
+        response.addProjectile(id, &bodies[i]);
+
+        const float grazing = angle(rng);
+        velocities[i] = math::Vec3{std::cos(grazing), -std::sin(grazing), 0.0f} * speed(rng);
+
+        if (i & 1)
+        {
+            manifolds[i] = {&colliders[i], &ground, {0.001f, {0.0f, 1.0f, 0.0f}}, id, 0};
+        }
+        else
+        {
+            // plate facing up and listed first, normal points from plate to projectile
+            manifolds[i] = {&plate, &colliders[i], {0.001f, {0.0f, 1.0f, 0.0f}}, 1, id};
+        }
+    }
+
+    size_t ricochets = 0;
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            bodies[i].setVelocity(velocities[i]);
+        }
+
+        const std::vector<ImpactResult>& results = response.resolve(manifolds);
+        benchmark::DoNotOptimize(results.data());
+
+        ricochets = 0;
+        for (const ImpactResult& result : results)
+        {
+            ricochets += result.outcome == ImpactOutcome::Ricochet;
+        }
+    }
+
+    state.counters["impacts"] = benchmark::Counter(static_cast<double>(count) * static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+    state.counters["ricochets"] = static_cast<double>(ricochets);
+}
+BENCHMARK(BM_ImpactResponse_Resolve)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,79 @@
+/*
+ * IntegratorBenchmark.cpp
+ */
+
+#include "BenchmarkWorlds.h"
+#include "math/Integrator.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace BulletPhysics;
+
+namespace {
+
+constexpr float DT = 0.001f;
+
+template<typename Integrator, auto makeBody = benchmarks::makeRifleBody>
+void runStep(benchmark::State& state, void (*setupWorld)(dynamics::PhysicsWorld&))
+{
+    dynamics::PhysicsWorld world;
+    setupWorld(world);
+
+    Integrator integrator;
+    auto initial = makeBody();
+    auto body = initial;
+
+    int steps = 0;
+    for (auto _ : state)
+    {
+        integrator.step(body, &world, DT);
+
+        // restart flight before the round leaves the realistic envelope
+        if (++steps == 2000)
+        {
+            state.PauseTiming();
+            body = initial;
+            steps = 0;
+            state.ResumeTiming();
+        }
+    }
+
+    benchmark::DoNotOptimize(body);
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+static void BM_Euler_Basic(benchmark::State& state) { runStep<math::EulerIntegrator>(state, benchmarks::setupBasicWorld); }
+static void BM_Midpoint_Basic(benchmark::State& state) { runStep<math::MidpointIntegrator>(state, benchmarks::setupBasicWorld); }
+static void BM_RK4_Basic(benchmark::State& state) { runStep<math::RK4Integrator>(state, benchmarks::setupBasicWorld); }
+
+static void BM_Euler_Full(benchmark::State& state) { runStep<math::EulerIntegrator>(state, benchmarks::setupFullWorld); }
+static void BM_Midpoint_Full(benchmark::State& state) { runStep<math::MidpointIntegrator>(state, benchmarks::setupFullWorld); }
+static void BM_RK4_Full(benchmark::State& state) { runStep<math::RK4Integrator>(state, benchmarks::setupFullWorld); }
+
+BENCHMARK(BM_Euler_Basic);
+BENCHMARK(BM_Midpoint_Basic);
+BENCHMARK(BM_RK4_Basic);
+
+BENCHMARK(BM_Euler_Full);
+BENCHMARK(BM_Midpoint_Full);
+BENCHMARK(BM_RK4_Full);
+
+// 6-DOF cost per step: attitude and spin integrated with translation, compare with 3-DOF above
+static void BM_RK4_Gravity(benchmark::State& state) { runStep<math::RK4Integrator>(state, benchmarks::setupGravityWorld); }
+static void BM_RK4_Gravity_6DOF(benchmark::State& state) { runStep<math::RK4Integrator, benchmarks::makeRifleBody6DOF>(state, benchmarks::setupGravityWorld); }
+static void BM_Euler_Basic_6DOF(benchmark::State& state) { runStep<math::EulerIntegrator, benchmarks::makeRifleBody6DOF>(state, benchmarks::setupBasicWorld); }
+static void BM_Midpoint_Basic_6DOF(benchmark::State& state) { runStep<math::MidpointIntegrator, benchmarks::makeRifleBody6DOF>(state, benchmarks::setupBasicWorld); }
+static void BM_RK4_Basic_6DOF(benchmark::State& state) { runStep<math::RK4Integrator, benchmarks::makeRifleBody6DOF>(state, benchmarks::setupBasicWorld); }
+
+static void BM_RK4_Full_6DOF(benchmark::State& state) { runStep<math::RK4Integrator, benchmarks::makeRifleBody6DOF>(state, benchmarks::setupFullWorld); }
+
+BENCHMARK(BM_RK4_Gravity);
+BENCHMARK(BM_RK4_Gravity_6DOF);
+
+BENCHMARK(BM_Euler_Basic_6DOF);
+BENCHMARK(BM_Midpoint_Basic_6DOF);
+BENCHMARK(BM_RK4_Basic_6DOF);
+
+BENCHMARK(BM_RK4_Full_6DOF);
@@ -0,0 +1,129 @@
+/*
+ * MPMBenchmark.cpp
+ */
+
+#include "BenchmarkWorlds.h"
+#include "dynamics/MPMSolver.h"
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace BulletPhysics;
+using namespace BulletPhysics::dynamics;
+
+namespace {
+
+constexpr float DT = 0.001f;
+
+template <typename T>
+MPMStateT<T> makeRifleState()
+{
+    auto body = benchmarks::makeRifleBody();
+    return {math::Vec3T<T>(body.getPosition()), math::Vec3T<T>(body.getVelocity()), body.getSpinRate()};
+}
+
+// 3 s flight launched 20 km from origin, where float spacing is ~2 mm
+template <typename T>
+MPMStateT<T> flyFarFromOrigin(MPMSolverT<T>& solver, const MPMProjectile& projectile)
+{
+    MPMStateT<T> current = makeRifleState<T>();
+    current.position += math::Vec3T<T>(20000, 0, 20000);
+
+    for (int i = 0; i < 3000; i++)
+    {
+        solver.step(projectile, current, static_cast<T>(DT));
+    }
+    return current;
+}
+
+} // namespace
+
+// one fused RK4 step in full world, compare with BM_RK4_Full (separate forces per stage)
+template <typename T>
+static void BM_MPM_Step_Full(benchmark::State& state)
+{
+    PhysicsWorld world;
+    benchmarks::setupFullWorld(world);
+
+    MPMSolverT<T> solver(&world);
+    const MPMProjectile& projectile = solver.prepare(benchmarks::rifleSpecs());
+
+    const MPMStateT<T> initial = makeRifleState<T>();
+    MPMStateT<T> current = initial;
+
+    int steps = 0;
+    for (auto _ : state)
+    {
+        solver.step(projectile, current, static_cast<T>(DT));
+
+        // restart flight before the round leaves the realistic envelope
+        if (++steps == 2000)
+        {
+            current = initial;
+            steps = 0;
+        }
+    }
+
+    benchmark::DoNotOptimize(current);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_MPM_Step_Full, float);
+BENCHMARK_TEMPLATE(BM_MPM_Step_Full, double);
+
+// many rounds of one load in full world
+template <typename T>
+static void BM_MPM_StepBatch_Full(benchmark::State& state)
+{
+    PhysicsWorld world;
+    benchmarks::setupFullWorld(world);
+
+    MPMSolverT<T> solver(&world);
+    const MPMProjectile& projectile = solver.prepare(benchmarks::rifleSpecs());
+
+    const std::vector<MPMBodyT<T>> initial(static_cast<size_t>(state.range(0)), MPMBodyT<T>{&projectile, makeRifleState<T>()});
+    std::vector<MPMBodyT<T>> bodies = initial;
+
+    int steps = 0;
+    for (auto _ : state)
+    {
+        solver.step(bodies, static_cast<T>(DT));
+
+        if (++steps == 2000)
+        {
+            state.PauseTiming();
+            bodies = initial;
+            steps = 0;
+            state.ResumeTiming();
+        }
+    }
+
+    benchmark::DoNotOptimize(bodies.data());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_MPM_StepBatch_Full, float)->RangeMultiplier(10)->Range(100, 10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_MPM_StepBatch_Full, double)->RangeMultiplier(10)->Range(100, 10000)->Unit(benchmark::kMicrosecond);
+
+// whole far-from-origin flight, error_m is final position distance from double run
+template <typename T>
+static void BM_MPM_Flight_FarFromOrigin(benchmark::State& state)
+{
+    PhysicsWorld world;
+    benchmarks::setupFullWorld(world);
+
+    MPMSolverd reference(&world);
+    const MPMProjectile& projectile = reference.prepare(benchmarks::rifleSpecs());
+    const MPMStated expected = flyFarFromOrigin(reference, projectile);
+
+    MPMSolverT<T> solver(&world);
+    MPMStateT<T> result;
+    for (auto _ : state)
+    {
+        result = flyFarFromOrigin(solver, projectile);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.counters["error_m"] = (math::Vec3d(result.position) - expected.position).length();
+}
+BENCHMARK_TEMPLATE(BM_MPM_Flight_FarFromOrigin, float)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_MPM_Flight_FarFromOrigin, double)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,85 @@
+/*
+ * NarrowphaseBenchmark.cpp
+ */
+
+#include "collision/BoxCollider.h"
+#include "collision/OBBBatch.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+using namespace BulletPhysics;
+using namespace BulletPhysics::collision;
+
+namespace {
+
+// boxes with random orientation around origin, roughly a third of them overlapping origin box
+std::vector<BoxCollider> makeRandomBoxes(size_t count, uint32_t seed, float spread = 2.5f)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+    std::vector<BoxCollider> boxes;
+    boxes.reserve(count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        BoxCollider box({1.0f + 0.5f * unit(rng), 1.0f + 0.5f * unit(rng), 1.0f + 0.5f * unit(rng)});
+
+        math::Vec3 x = math::Vec3{unit(rng), unit(rng), unit(rng)}.normalized();
+        math::Vec3 y = x.cross(math::Vec3{unit(rng), unit(rng), unit(rng)}).normalized();
+        box.setAxes(x, y, x.cross(y));
+        box.setPosition({spread * unit(rng), spread * unit(rng), spread * unit(rng)});
+
+        boxes.push_back(box);
+    }
+
+    return boxes;
+}
+
+} // namespace
+
+static void BM_BoxCollider_TestCollisionWithBox(benchmark::State& state)
+{
+    std::vector<BoxCollider> boxes = makeRandomBoxes(1024, 42, 1.0f);
+    BoxCollider query = makeRandomBoxes(1, 7).front();
+    query.setPosition({});
+
+    size_t i = 0;
+    CollisionInfo info;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(query.testCollisionWithBox(boxes[i++ & 1023], info));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_BoxCollider_TestCollisionWithBox);
+
+static void BM_OBBBatch_TestAgainst(benchmark::State& state)
+{
+    const size_t count = static_cast<size_t>(state.range(0));
+
+    OBBBatch batch;
+    batch.reserve(count);
+    for (const BoxCollider& box : makeRandomBoxes(count, 42, 1.0f))
+    {
+        batch.add(box);
+    }
+
+    BoxCollider query = makeRandomBoxes(1, 7).front();
+    query.setPosition({});
+
+    std::vector<OBBBatchHit> hits;
+    for (auto _ : state)
+    {
+        batch.testAgainst(query, hits);
+        benchmark::DoNotOptimize(hits.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+    state.counters["hits"] = static_cast<double>(hits.size());
+}
+BENCHMARK(BM_OBBBatch_TestAgainst)->RangeMultiplier(10)->Range(100, 100000);
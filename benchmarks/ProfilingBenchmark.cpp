@@ -0,0 +1,74 @@
+/*
+ * ProfilingBenchmark.cpp
+ */
+
+#include "BenchmarkWorlds.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace BulletPhysics;
+using namespace BulletPhysics::dynamics;
+
+namespace {
+
+RigidBody makeBody()
+{
+    RigidBody body;
+    body.setMass(0.01f);
+    body.setPosition({0.0f, 100.0f, 0.0f});
+    body.setVelocity({0.0f, 50.0f, 800.0f});
+    return body;
+}
+
+} // namespace
+
+// same two phases as PhysicsWorld::applyForces without any instrumentation hooks
+static void BM_ApplyForces_Uninstrumented(benchmark::State& state)
+{
+    PhysicsWorld world;
+    benchmarks::setupFullWorld(world);
+
+    RigidBody body = makeBody();
+    PhysicsContext context;
+
+    for (auto _ : state)
+    {
+        context.reset();
+        world.forEachEnvironment([&](EnvironmentId, environment::IEnvironment& env)
+        {
+            env.update(body, context);
+        });
+        world.forEachForce([&](ForceId, forces::IForce& force)
+        {
+            if (force.isActive())
+            {
+                force.apply(body, context, 0.001f);
+            }
+        });
+        body.clearForces();
+        benchmark::DoNotOptimize(context);
+    }
+}
+BENCHMARK(BM_ApplyForces_Uninstrumented);
+
+// with BULLET_PHYSICS_PROFILING off this must match the uninstrumented loop
+static void BM_ApplyForces(benchmark::State& state)
+{
+    PhysicsWorld world;
+    benchmarks::setupFullWorld(world);
+    world.getProfiler().setTraceCapacity(0);
+
+    RigidBody body = makeBody();
+
+    for (auto _ : state)
+    {
+        world.applyForces(body, 0.001f);
+        body.clearForces();
+        benchmark::DoNotOptimize(body);
+    }
+
+#ifdef BULLET_PHYSICS_PROFILING
+    state.SetLabel("profiling");
+#endif
+}
+BENCHMARK(BM_ApplyForces);
@@ -0,0 +1,40 @@
+/*
+ * SimulationBenchmark.cpp
+ */
+
+#include "BenchmarkWorlds.h"
+#include "dynamics/Simulation.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace BulletPhysics;
+using namespace BulletPhysics::dynamics;
+
+// 60 Hz frame of 120 Hz simulation: two RK4 ticks of all rounds in basic world plus render state blend,
+// tick cost reported by simulation itself
+static void BM_Simulation_Frame(benchmark::State& state)
+{
+    Simulation simulation;
+    benchmarks::setupBasicWorld(simulation.getWorld());
+
+    const auto prototype = benchmarks::makeRifleBody();
+    for (int64_t i = 0; i < state.range(0); i++)
+    {
+        simulation.spawn<projectile::ProjectileRigidBody>(prototype);
+    }
+
+    uint64_t tickNs = 0;
+    uint64_t substeps = 0;
+    for (auto _ : state)
+    {
+        const FrameStats& stats = simulation.advance(1.0f / 60.0f);
+        tickNs += stats.tickNs;
+        substeps += stats.substeps;
+        benchmark::DoNotOptimize(simulation.getRenderStates().data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["ns_per_tick"] = substeps ? static_cast<double>(tickNs) / static_cast<double>(substeps) : 0.0;
+    state.counters["substeps_per_frame"] = static_cast<double>(substeps) / static_cast<double>(state.iterations());
+}
+BENCHMARK(BM_Simulation_Frame)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
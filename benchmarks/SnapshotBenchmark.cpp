@@ -0,0 +1,157 @@
+/*
+ * SnapshotBenchmark.cpp
+ */
+
+#include "BenchmarkWorlds.h"
+#include "collision/BoxCollider.h"
+#include "collision/GroundCollider.h"
+#include "dynamics/RewindBuffer.h"
+#include "dynamics/Snapshot.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace BulletPhysics;
+using namespace BulletPhysics::dynamics;
+using namespace BulletPhysics::collision;
+
+namespace {
+
+// rounds in flight plus field of boxes, 1 in 8 boxes moving each tick like players
+struct Scene {
+    Simulation simulation;
+    GroundCollider ground{0.0f};
+    std::vector<std::unique_ptr<BoxCollider>> boxes;
+    CollisionDetection detection;
+    float fieldSize = 0.0f;
+
+    Scene(size_t bodies, size_t colliders)
+    {
+        benchmarks::setupBasicWorld(simulation.getWorld());
+
+        const auto prototype = benchmarks::makeRifleBody();
+        for (size_t i = 0; i < bodies; i++)
+        {
+            simulation.spawn<projectile::ProjectileRigidBody>(prototype);
+        }
+
+        fieldSize = 10.0f * std::sqrt(static_cast<float>(colliders));
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> coord(0.0f, fieldSize);
+
+        detection.addCollider(&ground);
+        for (size_t i = 0; i < colliders; i++)
+        {
+            auto box = std::make_unique<BoxCollider>(math::Vec3{1.0f, 2.0f, 1.0f});
+            box->setPosition({coord(rng), 1.0f, coord(rng)});
+            detection.addCollider(box.get());
+            boxes.push_back(std::move(box));
+        }
+    }
+
+    void tick()
+    {
+        simulation.tick();
+        for (size_t i = simulation.getTick() % 8; i < boxes.size(); i += 8)
+        {
+            boxes[i]->setPosition(boxes[i]->getPosition() + math::Vec3{0.05f, 0.0f, 0.0f});
+        }
+    }
+};
+
+constexpr size_t COLLIDERS = 1000;
+
+} // namespace
+
+// full capture of all bodies and colliders, compare with ns_per_tick of BM_Simulation_Frame
+static void BM_Snapshot_Capture(benchmark::State& state)
+{
+    Scene scene(static_cast<size_t>(state.range(0)), COLLIDERS);
+
+    Snapshot snapshot;
+    for (auto _ : state)
+    {
+        captureSnapshot(&scene.simulation, &scene.detection, snapshot);
+        benchmark::DoNotOptimize(snapshot.bodies.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(snapshot.bodies.size() + snapshot.colliders.size()));
+    state.counters["bytes"] = static_cast<double>(snapshot.bodies.size() * sizeof(BodyRecord) + snapshot.colliders.size() * sizeof(ColliderRecord));
+}
+BENCHMARK(BM_Snapshot_Capture)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+static void BM_Snapshot_Restore(benchmark::State& state)
+{
+    Scene scene(static_cast<size_t>(state.range(0)), COLLIDERS);
+
+    Snapshot snapshot;
+    captureSnapshot(&scene.simulation, &scene.detection, snapshot);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(restoreSnapshot(snapshot, &scene.simulation, &scene.detection));
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(snapshot.bodies.size() + snapshot.colliders.size()));
+}
+BENCHMARK(BM_Snapshot_Restore)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+// capture and push of one tick into 1 s rewind window, ticks run outside timing
+static void BM_Rewind_Push(benchmark::State& state)
+{
+    Scene scene(static_cast<size_t>(state.range(0)), COLLIDERS);
+    RewindBuffer rewind(120);
+
+    Snapshot snapshot;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        scene.tick();
+        state.ResumeTiming();
+
+        captureSnapshot(&scene.simulation, &scene.detection, snapshot);
+        rewind.push(snapshot);
+    }
+
+    const double raw = static_cast<double>(snapshot.bodies.size() * sizeof(BodyRecord) + snapshot.colliders.size() * sizeof(ColliderRecord));
+    state.counters["bytes_per_tick"] = static_cast<double>(rewind.memoryBytes()) / static_cast<double>(std::min<int64_t>(state.iterations(), 127));
+    state.counters["raw_bytes_per_tick"] = raw;
+}
+BENCHMARK(BM_Rewind_Push)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+// hitscan against colliders as of tick 60 ticks ago, different tick every query so each one decodes
+static void BM_Rewind_SweepAt(benchmark::State& state)
+{
+    Scene scene(static_cast<size_t>(state.range(0)), COLLIDERS);
+    RewindBuffer rewind(120);
+
+    Snapshot snapshot;
+    for (int i = 0; i < 120; i++)
+    {
+        scene.tick();
+        captureSnapshot(&scene.simulation, &scene.detection, snapshot);
+        rewind.push(snapshot);
+    }
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> coord(0.0f, scene.fieldSize);
+
+    uint64_t back = 0;
+    int64_t hits = 0;
+    for (auto _ : state)
+    {
+        const uint64_t tick = rewind.latestTick() - 60 + back;
+        back = (back + 1) % 60;
+
+        const math::Vec3 start{coord(rng), 1.0f, 0.0f};
+        SweepHit hit;
+        hits += rewind.sweepAt(tick, scene.detection, scene.simulation.getOrigin(), start, start + math::Vec3{0.0f, 0.0f, scene.fieldSize}, 0.0f, hit);
+    }
+
+    state.counters["hit_rate"] = static_cast<double>(hits) / static_cast<double>(state.iterations());
+}
+BENCHMARK(BM_Rewind_SweepAt)->Arg(10000)->Unit(benchmark::kMicrosecond);
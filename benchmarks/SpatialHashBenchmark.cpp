@@ -0,0 +1,103 @@
+/*
+ * SpatialHashBenchmark.cpp
+ */
+
+#include "collision/SpatialHashGrid.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace BulletPhysics;
+using namespace BulletPhysics::collision;
+
+namespace {
+
+// fragment cloud shortly after detonation, about 4 m spread; 1.5 m cells match 1500 m/s fragments at 1 ms step
+struct FragmentCloud {
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> z;
+    SpatialHashGrid grid{1.5f};
+
+    explicit FragmentCloud(size_t count) : x(count), y(count), z(count)
+    {
+        std::mt19937 rng(42);
+        std::normal_distribution<float> offset(0.0f, 4.0f);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            x[i] = offset(rng);
+            y[i] = offset(rng) + 5.0f;
+            z[i] = offset(rng);
+        }
+
+        grid.rebuild(x.data(), y.data(), z.data(), nullptr, count);
+    }
+};
+
+std::vector<math::Vec3> makeQueries(size_t count)
+{
+    std::mt19937 rng(7);
+    std::normal_distribution<float> offset(0.0f, 4.0f);
+
+    std::vector<math::Vec3> queries(count);
+    for (auto& query : queries)
+    {
+        query = {offset(rng), offset(rng) + 5.0f, offset(rng)};
+    }
+    return queries;
+}
+
+} // namespace
+
+static void BM_SpatialHashGrid_Rebuild(benchmark::State& state)
+{
+    FragmentCloud cloud(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        cloud.grid.rebuild(cloud.x.data(), cloud.y.data(), cloud.z.data(), nullptr, cloud.x.size());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SpatialHashGrid_Rebuild)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMicrosecond);
+
+static void BM_SpatialHashGrid_QueryRadius(benchmark::State& state)
+{
+    FragmentCloud cloud(static_cast<size_t>(state.range(0)));
+    std::vector<math::Vec3> queries = makeQueries(1024);
+
+    size_t i = 0;
+    std::vector<uint32_t> found;
+    for (auto _ : state)
+    {
+        found.clear();
+        cloud.grid.queryRadius(queries[i++ & 1023], 1.0f, found);
+        benchmark::DoNotOptimize(found.data());
+    }
+
+    state.counters["fragments"] = static_cast<double>(state.range(0));
+}
+BENCHMARK(BM_SpatialHashGrid_QueryRadius)->RangeMultiplier(10)->Range(1000, 100000);
+
+static void BM_SpatialHashGrid_Nearest(benchmark::State& state)
+{
+    FragmentCloud cloud(static_cast<size_t>(state.range(0)));
+    std::vector<math::Vec3> queries = makeQueries(1024);
+
+    size_t i = 0;
+    uint32_t index;
+    float distance;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(cloud.grid.nearest(queries[i++ & 1023], 10.0f, index, distance));
+    }
+
+    state.counters["fragments"] = static_cast<double>(state.range(0));
+}
+BENCHMARK(BM_SpatialHashGrid_Nearest)->RangeMultiplier(10)->Range(1000, 100000);
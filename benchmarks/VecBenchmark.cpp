@@ -0,0 +1,79 @@
+/*
+ * VecBenchmark.cpp
+ */
+
+#include "math/Vec3.h"
+
+#include <benchmark/benchmark.h>
+
+using BulletPhysics::math::Vec3;
+
+static void BM_Vec3_Add(benchmark::State& state)
+{
+    Vec3 a{1.0f, 2.0f, 3.0f};
+    Vec3 b{0.5f, -0.25f, 0.125f};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(a + b);
+    }
+}
+BENCHMARK(BM_Vec3_Add);
+
+static void BM_Vec3_Scale(benchmark::State& state)
+{
+    Vec3 a{1.0f, 2.0f, 3.0f};
+    float s = 0.999f;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(a * s);
+    }
+}
+BENCHMARK(BM_Vec3_Scale);
+
+static void BM_Vec3_Dot(benchmark::State& state)
+{
+    Vec3 a{1.0f, 2.0f, 3.0f};
+    Vec3 b{0.5f, -0.25f, 0.125f};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(a.dot(b));
+    }
+}
+BENCHMARK(BM_Vec3_Dot);
+
+static void BM_Vec3_Cross(benchmark::State& state)
+{
+    Vec3 a{1.0f, 2.0f, 3.0f};
+    Vec3 b{0.5f, -0.25f, 0.125f};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(a.cross(b));
+    }
+}
+BENCHMARK(BM_Vec3_Cross);
+
+static void BM_Vec3_Length(benchmark::State& state)
+{
+    Vec3 a{1.0f, 2.0f, 3.0f};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(a.length());
+    }
+}
+BENCHMARK(BM_Vec3_Length);
+
+static void BM_Vec3_Normalized(benchmark::State& state)
+{
+    Vec3 a{1.0f, 2.0f, 3.0f};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(a.normalized());
+    }
+}
+BENCHMARK(BM_Vec3_Normalized);
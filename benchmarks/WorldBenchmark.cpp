@@ -0,0 +1,52 @@
+/*
+ * WorldBenchmark.cpp
+ */
+
+#include "BenchmarkWorlds.h"
+
+#include <benchmark/benchmark.h>
+
+#include <string_view>
+#include <vector>
+
+using namespace BulletPhysics;
+using namespace BulletPhysics::dynamics;
+
+// debug overlay polling every force of full world by name once per frame
+static void BM_World_GetForceByName(benchmark::State& state)
+{
+    PhysicsWorld world;
+    benchmarks::setupFullWorld(world);
+
+    const std::string_view names[] = {"Gravitational", "Aerodynamic Drag", "Coriolis", "Lift", "Magnus", "Spin Decay"};
+
+    for (auto _ : state)
+    {
+        for (std::string_view name : names)
+        {
+            benchmark::DoNotOptimize(world.getForce(name));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * std::size(names));
+}
+BENCHMARK(BM_World_GetForceByName);
+
+// same poll with keys kept from registration
+static void BM_World_GetForceById(benchmark::State& state)
+{
+    PhysicsWorld world;
+    benchmarks::setupFullWorld(world);
+
+    std::vector<ForceId> ids;
+    world.forEachForce([&](ForceId id, forces::IForce&) { ids.push_back(id); });
+
+    for (auto _ : state)
+    {
+        for (ForceId id : ids)
+        {
+            benchmark::DoNotOptimize(world.getForce(id));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * ids.size());
+}
+BENCHMARK(BM_World_GetForceById);
@@ -14,6 +14,7 @@ inline math::Vec3 GRAVITY{0.0f, -9.80665f, 0.0f};
 
 // conversion
 inline constexpr float CELSIUS_TO_KELVIN = 273.15f;     // between Celsius and Kelvin
+inline constexpr float LB_PER_IN2_TO_KG_PER_M2 = 703.0696f;     // ballistic coefficient and sectional density units
 
 // atmospheric constants (ISA model)
 inline constexpr float TROPOSPHERE_MAX = 11000.0f;                      // m (troposphere height)
@@ -23,6 +24,11 @@ inline constexpr float BASE_ATMOSPHERIC_DENSITY = 1.225f;               // kg/m^
 inline constexpr float BASE_SPEED_OF_SOUND = 340.294f;                  // m/s
 inline constexpr float LAPSE_RATE = 0.0065f;                            // K/m (temperature lapse rate)
 inline constexpr float GAS_CONSTANT_DRY_AIR = 287.058f;                 // J/(kg·K)
+inline constexpr float HEAT_CAPACITY_RATIO = 1.4f;                      // gamma (dry air)
+
+// air viscosity (Sutherland's law)
+inline constexpr float SUTHERLAND_C1 = 1.458e-6f;                       // kg/(m·s·K^0.5)
+inline constexpr float SUTHERLAND_S = 110.4f;                           // K
 
 // humidity constants (Tetens)
 inline constexpr float GAS_CONSTANT_WATER_VAPOR = 461.495f;             // J/(kg·K)
@@ -43,6 +49,7 @@ static constexpr float DEFAULT_CD = 0.3f;
 static constexpr float DEFAULT_C_M_ALPHA = 4.0f;
 static constexpr float DEFAULT_C_L_ALPHA = 0.10f;
 static constexpr float DEFAULT_C_MAG_F = 0.10f;
+static constexpr float DEFAULT_C_SPIN = -0.012f;    // roll damping
 
 } // namespace constants
 } // namespace BulletPhysics
\ No newline at end of file
@@ -0,0 +1,35 @@
+/*
+ * AABB.h
+ */
+
+#pragma once
+
+#include "math/Vec3.h"
+
+#include <limits>
+
+namespace BulletPhysics {
+namespace collision {
+
+// Axis-Aligned Bounding Box (AABB) used by broadphase
+struct AABB {
+    math::Vec3 min{};
+    math::Vec3 max{};
+
+    bool overlaps(const AABB& other) const
+    {
+        return min.x <= other.max.x && max.x >= other.min.x
+            && min.y <= other.max.y && max.y >= other.min.y
+            && min.z <= other.max.z && max.z >= other.min.z;
+    }
+
+    // unbounded in every direction except above given height (half-space y <= top)
+    static AABB halfSpaceBelow(float top)
+    {
+        constexpr float inf = std::numeric_limits<float>::infinity();
+        return {{-inf, -inf, -inf}, {inf, top, inf}};
+    }
+};
+
+} // namespace collision
+} // namespace BulletPhysics
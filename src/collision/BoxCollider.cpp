@@ -3,6 +3,7 @@
  */
 
 #include "BoxCollider.h"
+#include "Geometry.h"
 
 namespace BulletPhysics {
 namespace collision {
@@ -16,59 +17,289 @@ void BoxCollider::setAxes(const math::Vec3& axisX, const math::Vec3& axisY, cons
     m_axes[2] = axisZ;
 }
 
-bool BoxCollider::testCollision(const Collider& other, CollisionInfo& outInfo) const
+AABB BoxCollider::getBounds() const
 {
-    switch (other.getShape()) {
-        case CollisionShape::Box: {
-            return testCollisionWithBox(dynamic_cast<const BoxCollider&>(other), outInfo);
+    math::Vec3 half = m_size * 0.5f;
+
+    // world extent of oriented box: sum of projected half-axes
+    math::Vec3 extent{
+        std::abs(m_axes[0].x) * half.x + std::abs(m_axes[1].x) * half.y + std::abs(m_axes[2].x) * half.z,
+        std::abs(m_axes[0].y) * half.x + std::abs(m_axes[1].y) * half.y + std::abs(m_axes[2].y) * half.z,
+        std::abs(m_axes[0].z) * half.x + std::abs(m_axes[1].z) * half.y + std::abs(m_axes[2].z) * half.z
+    };
+
+    return {m_position - extent, m_position + extent};
+}
+
+bool BoxCollider::testPoint(const math::Vec3& point) const
+{
+    math::Vec3 half = m_size * 0.5f;
+    math::Vec3 diff = point - m_position;
+
+    // project onto box axes
+    return std::abs(diff.dot(m_axes[0])) <= half.x && std::abs(diff.dot(m_axes[1])) <= half.y && std::abs(diff.dot(m_axes[2])) <= half.z;
+}
+
+bool BoxCollider::testSegment(const math::Vec3& start, const math::Vec3& end, SweepInfo& outInfo) const
+{
+    return testSweptSphere(start, end, 0.0f, outInfo);
+}
+
+// slab method in box frame: intersect parameter intervals of three pairs of parallel faces,
+// swept sphere moves faces out by its radius, entries past edges are refined against edge capsules
+bool BoxCollider::testSweptSphere(const math::Vec3& start, const math::Vec3& end, float radius, SweepInfo& outInfo) const
+{
+    const float half[3] = {m_size.x * 0.5f + radius, m_size.y * 0.5f + radius, m_size.z * 0.5f + radius};
+
+    math::Vec3 delta = end - start;
+    math::Vec3 local = start - m_position;
+
+    float tEnter = -std::numeric_limits<float>::infinity();
+    float tExit = std::numeric_limits<float>::infinity();
+    math::Vec3 enterNormal{};
+
+    for (int i = 0; i < 3; i++)
+    {
+        float p = local.dot(m_axes[i]);
+        float d = delta.dot(m_axes[i]);
+
+        // parallel to slab
+        if (std::abs(d) < 1e-8f)
+        {
+            if (std::abs(p) > half[i])
+            {
+                return false;
+            }
+            continue;
         }
-        case CollisionShape::Ground: {
-            return testCollisionWithGround(dynamic_cast<const GroundCollider&>(other), outInfo);
+
+        float t1 = (-half[i] - p) / d;
+        float t2 = (half[i] - p) / d;
+
+        // moving in +axis direction enters through -axis face
+        math::Vec3 normal = d > 0.0f ? m_axes[i] * -1.0f : m_axes[i];
+        if (t1 > t2)
+        {
+            std::swap(t1, t2);
         }
-        default:
+
+        if (t1 > tEnter)
+        {
+            tEnter = t1;
+            enterNormal = normal;
+        }
+        tExit = std::min(tExit, t2);
+
+        if (tEnter > tExit)
+        {
             return false;
+        }
+    }
+
+    if (tExit < 0.0f || tEnter > 1.0f)
+    {
+        return false;
     }
+
+    // start inside box
+    if (tEnter < 0.0f)
+    {
+        outInfo.time = 0.0f;
+        outInfo.point = start;
+        outInfo.normal = delta.normalized() * -1.0f;
+        return true;
+    }
+
+    if (radius > 0.0f)
+    {
+        return refineEdgeEntry(start, delta, radius, tEnter, enterNormal, outInfo);
+    }
+
+    outInfo.time = tEnter;
+    outInfo.point = start + delta * tEnter;
+    outInfo.normal = enterNormal;
+    return true;
 }
 
-bool BoxCollider::testPoint(const math::Vec3& point) const
+// entry into grown box beyond two or three faces lies in rounded edge or corner region,
+// actual contact is earliest hit against capsules of edges meeting there (Ericson, 5.5.7)
+bool BoxCollider::refineEdgeEntry(const math::Vec3& start, const math::Vec3& delta, float radius, float tEnter, const math::Vec3& enterNormal, SweepInfo& outInfo) const
 {
-    math::Vec3 half = m_size * 0.5f;
-    math::Vec3 diff = point - m_position;
+    const float half[3] = {m_size.x * 0.5f, m_size.y * 0.5f, m_size.z * 0.5f};
+
+    math::Vec3 entry = start + delta * tEnter - m_position;
+    float local[3];
+    float corner[3];
+    int outside = 0;
+
+    for (int i = 0; i < 3; i++)
+    {
+        local[i] = entry.dot(m_axes[i]);
+        corner[i] = local[i] < 0.0f ? -half[i] : half[i];
+        outside += std::abs(local[i]) > half[i] ? 1 : 0;
+    }
 
-    return std::abs(diff.x) <= half.x && std::abs(diff.y) <= half.y && std::abs(diff.z) <= half.z;
+    // face region
+    if (outside < 2)
+    {
+        outInfo.time = tEnter;
+        outInfo.point = start + delta * tEnter - enterNormal * radius;
+        outInfo.normal = enterNormal;
+        return true;
+    }
+
+    auto toWorld = [this](const float* p) { return m_position + m_axes[0] * p[0] + m_axes[1] * p[1] + m_axes[2] * p[2]; };
+
+    bool hit = false;
+    float time = 1.0f;
+    math::Vec3 edgeA;
+    math::Vec3 edgeB;
+
+    // edges along axes on which entry lies within box, from nearest corner
+    for (int i = 0; i < 3; i++)
+    {
+        if (outside == 2 && std::abs(local[i]) > half[i])
+        {
+            continue;
+        }
+
+        float other[3] = {corner[0], corner[1], corner[2]};
+        other[i] = -other[i];
+
+        math::Vec3 a = toWorld(corner);
+        math::Vec3 b = toWorld(other);
+
+        float t;
+        if (geometry::segmentCapsule(start, delta, a, b, radius, t) && t <= time)
+        {
+            hit = true;
+            time = t;
+            edgeA = a;
+            edgeB = b;
+        }
+    }
+
+    if (!hit)
+    {
+        return false;
+    }
+
+    math::Vec3 center = start + delta * time;
+    outInfo.point = geometry::closestPointOnSegment(center, edgeA, edgeB);
+    outInfo.time = time;
+    outInfo.normal = (center - outInfo.point).normalized();
+    return true;
 }
 
+// separating axis test (SAT) of two OBBs: 3 + 3 face axes and 9 edge cross products,
+// face axes are tested first since they separate most often; penetration is taken along axis of minimum overlap
 bool BoxCollider::testCollisionWithBox(const BoxCollider& other, CollisionInfo& outInfo) const
 {
-    math::Vec3 half1 = m_size * 0.5f;
-    math::Vec3 half2 = other.m_size * 0.5f;
+    const math::Vec3* A = m_axes;
+    const math::Vec3* B = other.m_axes;
+    const float a[3] = {m_size.x * 0.5f, m_size.y * 0.5f, m_size.z * 0.5f};
+    const float b[3] = {other.m_size.x * 0.5f, other.m_size.y * 0.5f, other.m_size.z * 0.5f};
 
-    math::Vec3 diff = other.m_position - m_position;
+    math::Vec3 d = other.m_position - m_position;
 
-    if (std::abs(diff.x) > half1.x + half2.x || std::abs(diff.y) > half1.y + half2.y || std::abs(diff.z) > half1.z + half2.z)
+    // rotation of other expressed in our frame, epsilon counters arithmetic error for parallel edges
+    float R[3][3];
+    float absR[3][3];
+    for (int i = 0; i < 3; i++)
     {
-        return false;
+        for (int j = 0; j < 3; j++)
+        {
+            R[i][j] = A[i].dot(B[j]);
+            absR[i][j] = std::abs(R[i][j]) + SAT_EPSILON;
+        }
     }
 
-    // find axis of minimum penetration
-    float minPenetration = std::abs(diff.x) - (half1.x + half2.x);
-    outInfo.normal = diff.x > 0.0f ? math::Vec3{1.0f, 0.0f, 0.0f} : math::Vec3{-1.0f, 0.0f, 0.0f};
-    outInfo.penetration = -minPenetration;
+    // translation in our frame
+    const float t[3] = {d.dot(A[0]), d.dot(A[1]), d.dot(A[2])};
 
-    float penY = std::abs(diff.y) - (half1.y + half2.y);
-    if (-penY < outInfo.penetration)
+    // edge candidates are scored with bias, minScore equals minOverlap for face axes
+    float minScore = std::numeric_limits<float>::infinity();
+    float minOverlap = minScore;
+    math::Vec3 normal{};
+
+    // our face axes
+    for (int i = 0; i < 3; i++)
     {
-        outInfo.penetration = -penY;
-        outInfo.normal = diff.y > 0.0f ? math::Vec3{0.0f, 1.0f, 0.0f} : math::Vec3{0.0f, -1.0f, 0.0f};
+        float rb = b[0] * absR[i][0] + b[1] * absR[i][1] + b[2] * absR[i][2];
+        float overlap = a[i] + rb - std::abs(t[i]);
+        if (overlap < 0.0f)
+        {
+            return false;
+        }
+        if (overlap < minScore)
+        {
+            minScore = overlap;
+            minOverlap = overlap;
+            normal = t[i] < 0.0f ? A[i] * -1.0f : A[i];
+        }
     }
 
-    float penZ = std::abs(diff.z) - (half1.z + half2.z);
-    if (-penZ < outInfo.penetration)
+    // other face axes
+    for (int j = 0; j < 3; j++)
     {
-        outInfo.penetration = -penZ;
-        outInfo.normal = diff.z > 0.0f ? math::Vec3{0.0f, 0.0f, 1.0f} : math::Vec3{0.0f, 0.0f, -1.0f};
+        float ra = a[0] * absR[0][j] + a[1] * absR[1][j] + a[2] * absR[2][j];
+        float dist = t[0] * R[0][j] + t[1] * R[1][j] + t[2] * R[2][j];
+        float overlap = ra + b[j] - std::abs(dist);
+        if (overlap < 0.0f)
+        {
+            return false;
+        }
+        if (overlap < minScore)
+        {
+            minScore = overlap;
+            minOverlap = overlap;
+            normal = dist < 0.0f ? B[j] * -1.0f : B[j];
+        }
     }
 
+    // edge axes A_i x B_j
+    for (int i = 0; i < 3; i++)
+    {
+        const int i1 = (i + 1) % 3;
+        const int i2 = (i + 2) % 3;
+
+        for (int j = 0; j < 3; j++)
+        {
+            const int j1 = (j + 1) % 3;
+            const int j2 = (j + 2) % 3;
+
+            float ra = a[i1] * absR[i2][j] + a[i2] * absR[i1][j];
+            float rb = b[j1] * absR[i][j2] + b[j2] * absR[i][j1];
+            float dist = t[i2] * R[i1][j] - t[i1] * R[i2][j];
+
+            if (std::abs(dist) > ra + rb)
+            {
+                return false;
+            }
+
+            // parallel edges give degenerate axis, already covered by face axes
+            float length = std::sqrt(std::max(0.0f, 1.0f - R[i][j] * R[i][j]));
+            if (length < SAT_PARALLEL_LIMIT)
+            {
+                continue;
+            }
+
+            // prefer face contacts unless edge contact is clearly shallower
+            float overlap = (ra + rb - std::abs(dist)) / length;
+            float score = overlap / SAT_EDGE_BIAS;
+            if (score < minScore)
+            {
+                minScore = score;
+                minOverlap = overlap;
+                math::Vec3 axis = A[i].cross(B[j]) / length;
+                normal = dist < 0.0f ? axis * -1.0f : axis;
+            }
+        }
+    }
+
+    outInfo.penetration = minOverlap;
+    outInfo.normal = normal;
+
     return true;
 }
 
@@ -107,5 +338,39 @@ bool BoxCollider::testCollisionWithGround(const GroundCollider& ground, Collisio
     return false;
 }
 
+bool BoxCollider::testCollisionWithHeightfield(const HeightfieldCollider& heightfield, CollisionInfo& outInfo) const
+{
+    math::Vec3 half = m_size * 0.5f;
+
+    // deepest vertex below terrain
+    float maxPenetration = 0.0f;
+    math::Vec3 deepest{};
+
+    for (int i = 0; i < 8; i++)
+    {
+        float sx = (i & 1) ? half.x : -half.x;
+        float sy = (i & 2) ? half.y : -half.y;
+        float sz = (i & 4) ? half.z : -half.z;
+
+        math::Vec3 vertex = m_position + m_axes[0] * sx + m_axes[1] * sy + m_axes[2] * sz;
+
+        float height;
+        if (heightfield.getHeight(vertex.x, vertex.z, height) && height - vertex.y > maxPenetration)
+        {
+            maxPenetration = height - vertex.y;
+            deepest = vertex;
+        }
+    }
+
+    if (maxPenetration > 0.0f)
+    {
+        heightfield.getNormal(deepest.x, deepest.z, outInfo.normal);
+        outInfo.penetration = maxPenetration;
+        return true;
+    }
+
+    return false;
+}
+
 } // namespace collision
 } // namespace BulletPhysics
@@ -6,9 +6,11 @@
 
 #include "Collider.h"
 #include "GroundCollider.h"
+#include "HeightfieldCollider.h"
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 
 namespace BulletPhysics {
 namespace collision {
@@ -24,6 +26,8 @@ public:
     const math::Vec3& getPosition() const override { return m_position; }
     void setPosition(const math::Vec3& pos) override { m_position = pos; }
 
+    AABB getBounds() const override;
+
     const math::Vec3& getSize() const { return m_size; }
     void setSize(const math::Vec3& size) { m_size = size; }
 
@@ -31,11 +35,18 @@ public:
     void setAxes(const math::Vec3& axisX, const math::Vec3& axisY, const math::Vec3& axisZ);
     const math::Vec3* getAxes() const { return m_axes; }
 
-    bool testCollision(const Collider& other, CollisionInfo& outInfo) const override;
     bool testPoint(const math::Vec3& point) const override;
+    bool testSegment(const math::Vec3& start, const math::Vec3& end, SweepInfo& outInfo) const override;
+    bool testSweptSphere(const math::Vec3& start, const math::Vec3& end, float radius, SweepInfo& outInfo) const override;
 
     bool testCollisionWithBox(const BoxCollider& box, CollisionInfo& outInfo) const;
     bool testCollisionWithGround(const GroundCollider& ground, CollisionInfo& outInfo) const;
+    bool testCollisionWithHeightfield(const HeightfieldCollider& heightfield, CollisionInfo& outInfo) const;
+
+    // SAT tuning
+    static constexpr float SAT_EPSILON = 1e-6f;          // added to |R| against near-parallel edge noise
+    static constexpr float SAT_PARALLEL_LIMIT = 1e-4f;   // minimal |A_i x B_j| treated as valid axis
+    static constexpr float SAT_EDGE_BIAS = 0.95f;        // edge axis must beat face axis by 5% to be chosen
 
 private:
     math::Vec3 m_position{};
@@ -46,6 +57,8 @@ private:
         {0.0f, 0.0f, 1.0f}
     };
 
+    bool refineEdgeEntry(const math::Vec3& start, const math::Vec3& delta, float radius, float tEnter, const math::Vec3& enterNormal, SweepInfo& outInfo) const;
+
     friend class GroundCollider;
 };
 
@@ -0,0 +1,301 @@
+/*
+ * Broadphase.cpp
+ */
+
+#include "Broadphase.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace BulletPhysics {
+namespace collision {
+
+namespace {
+
+float component(const math::Vec3& v, int axis)
+{
+    return axis == 0 ? v.x : (axis == 1 ? v.y : v.z);
+}
+
+bool isUnbounded(const AABB& bounds, int axis)
+{
+    return std::isinf(component(bounds.min, axis)) || std::isinf(component(bounds.max, axis));
+}
+
+// overlap without short-circuit, most sweep candidates fail on other axes at random and branches mispredict;
+// summed as integers since compilers turn chained && or & of comparisons back into jumps
+bool overlapsBranchless(const AABB& a, const AABB& b)
+{
+    int passed = static_cast<int>(a.min.x <= b.max.x) + static_cast<int>(a.max.x >= b.min.x)
+               + static_cast<int>(a.min.y <= b.max.y) + static_cast<int>(a.max.y >= b.min.y)
+               + static_cast<int>(a.min.z <= b.max.z) + static_cast<int>(a.max.z >= b.min.z);
+    return passed == 6;
+}
+
+// LSD radix sort by (idA, idB) packed into idBits-wide halves, 11-bit digits;
+// unbounded proxies add one pair per collider, comparison sort of those dominated update
+void sortPairs(std::vector<BroadphasePair>& pairs, std::vector<BroadphasePair>& scratch)
+{
+    auto byIds = [](const BroadphasePair& lhs, const BroadphasePair& rhs)
+    {
+        return lhs.idA != rhs.idA ? lhs.idA < rhs.idA : lhs.idB < rhs.idB;
+    };
+
+    if (pairs.size() < 256)
+    {
+        std::sort(pairs.begin(), pairs.end(), byIds);
+        return;
+    }
+
+    uint32_t maxId = 0;
+    for (const BroadphasePair& pair : pairs)
+    {
+        maxId = std::max(maxId, pair.idB);
+    }
+
+    const int idBits = std::bit_width(maxId);
+    const int keyBits = 2 * idBits;
+    auto key = [idBits](const BroadphasePair& pair) { return (static_cast<uint64_t>(pair.idA) << idBits) | pair.idB; };
+
+    constexpr int DIGIT_BITS = 11;
+    constexpr size_t BUCKETS = size_t{1} << DIGIT_BITS;
+
+    scratch.resize(pairs.size());
+
+    for (int shift = 0; shift < keyBits; shift += DIGIT_BITS)
+    {
+        size_t offsets[BUCKETS] = {};
+        for (const BroadphasePair& pair : pairs)
+        {
+            offsets[(key(pair) >> shift) & (BUCKETS - 1)]++;
+        }
+
+        size_t sum = 0;
+        for (size_t& offset : offsets)
+        {
+            size_t count = offset;
+            offset = sum;
+            sum += count;
+        }
+
+        for (const BroadphasePair& pair : pairs)
+        {
+            scratch[offsets[(key(pair) >> shift) & (BUCKETS - 1)]++] = pair;
+        }
+        pairs.swap(scratch);
+    }
+}
+
+} // namespace
+
+SweepAndPrune::SweepAndPrune(int axis) : m_axis(std::clamp(axis, 0, 2)) {}
+
+void SweepAndPrune::add(Collider* collider, uint32_t id)
+{
+    if (!collider)
+    {
+        return;
+    }
+
+    Proxy proxy{collider, id, collider->getShape(), collider->getBounds()};
+
+    if (isUnbounded(proxy.bounds, m_axis))
+    {
+        m_unbounded.push_back(proxy);
+    }
+    else
+    {
+        m_proxies.push_back(proxy);
+        m_sorted = false;
+    }
+}
+
+void SweepAndPrune::remove(Collider* collider)
+{
+    auto matches = [collider](const Proxy& proxy) { return proxy.collider == collider; };
+
+    // erase keeps remaining proxies sorted
+    auto it = std::find_if(m_proxies.begin(), m_proxies.end(), matches);
+    if (it != m_proxies.end())
+    {
+        m_proxies.erase(it);
+        return;
+    }
+
+    it = std::find_if(m_unbounded.begin(), m_unbounded.end(), matches);
+    if (it != m_unbounded.end())
+    {
+        m_unbounded.erase(it);
+    }
+}
+
+void SweepAndPrune::clear()
+{
+    m_proxies.clear();
+    m_unbounded.clear();
+    m_pairs.clear();
+    m_sorted = true;
+}
+
+void SweepAndPrune::setAxis(int axis)
+{
+    axis = std::clamp(axis, 0, 2);
+    if (axis == m_axis)
+    {
+        return;
+    }
+
+    m_axis = axis;
+
+    // redistribute proxies, finiteness depends on axis
+    std::vector<Proxy> proxies;
+    proxies.reserve(proxyCount());
+    proxies.insert(proxies.end(), m_proxies.begin(), m_proxies.end());
+    proxies.insert(proxies.end(), m_unbounded.begin(), m_unbounded.end());
+
+    m_proxies.clear();
+    m_unbounded.clear();
+
+    for (const Proxy& proxy : proxies)
+    {
+        add(proxy.collider, proxy.id);
+    }
+}
+
+const std::vector<BroadphasePair>& SweepAndPrune::update()
+{
+    m_pairs.clear();
+
+    // refresh bounds (colliders may move or resize between frames)
+    m_maxExtent = 0.0f;
+    for (Proxy& proxy : m_proxies)
+    {
+        proxy.bounds = proxy.collider->getBounds();
+        m_maxExtent = std::max(m_maxExtent, component(proxy.bounds.max, m_axis) - component(proxy.bounds.min, m_axis));
+    }
+    for (Proxy& proxy : m_unbounded)
+    {
+        proxy.bounds = proxy.collider->getBounds();
+    }
+
+    const int axis = m_axis;
+    auto byMin = [axis](const Proxy& lhs, const Proxy& rhs)
+    {
+        return component(lhs.bounds.min, axis) < component(rhs.bounds.min, axis);
+    };
+
+    if (!m_sorted)
+    {
+        std::sort(m_proxies.begin(), m_proxies.end(), byMin);
+        m_sorted = true;
+    }
+
+    // insertion sort, order from last frame makes this almost linear
+    for (size_t i = 1; i < m_proxies.size(); i++)
+    {
+        Proxy proxy = m_proxies[i];
+        const float key = component(proxy.bounds.min, axis);
+
+        size_t j = i;
+        while (j > 0 && component(m_proxies[j - 1].bounds.min, axis) > key)
+        {
+            m_proxies[j] = m_proxies[j - 1];
+            j--;
+        }
+        m_proxies[j] = proxy;
+    }
+
+    // sweep: only proxies starting before current one ends can overlap it,
+    // locals keep pair insertion from forcing reloads of proxy array
+    const Proxy* proxies = m_proxies.data();
+    const size_t count = m_proxies.size();
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const Proxy& a = proxies[i];
+        const float end = component(a.bounds.max, axis);
+
+        for (size_t j = i + 1; j < count; j++)
+        {
+            const Proxy& b = proxies[j];
+            if (component(b.bounds.min, axis) > end)
+            {
+                break;
+            }
+
+            if (overlapsBranchless(a.bounds, b.bounds))
+            {
+                addPair(a, b);
+            }
+        }
+    }
+
+    // unbounded proxies against everything finite
+    for (const Proxy& unbounded : m_unbounded)
+    {
+        for (const Proxy& proxy : m_proxies)
+        {
+            if (overlapsBranchless(unbounded.bounds, proxy.bounds))
+            {
+                addPair(unbounded, proxy);
+            }
+        }
+    }
+
+    // deterministic order regardless of sweep order
+    sortPairs(m_pairs, m_pairScratch);
+
+    return m_pairs;
+}
+
+void SweepAndPrune::query(const AABB& bounds, std::vector<Collider*>& outColliders) const
+{
+    const int axis = m_axis;
+    const float queryMin = component(bounds.min, axis);
+    const float queryMax = component(bounds.max, axis);
+
+    auto first = m_proxies.begin();
+    if (m_sorted)
+    {
+        // no proxy starting before (queryMin - largest extent) can reach query
+        const float from = queryMin - m_maxExtent;
+        first = std::lower_bound(m_proxies.begin(), m_proxies.end(), from, [axis](const Proxy& proxy, float value)
+        {
+            return component(proxy.bounds.min, axis) < value;
+        });
+    }
+
+    for (auto it = first; it != m_proxies.end(); ++it)
+    {
+        if (m_sorted && component(it->bounds.min, axis) > queryMax)
+        {
+            break;
+        }
+
+        if (it->bounds.overlaps(bounds))
+        {
+            outColliders.push_back(it->collider);
+        }
+    }
+
+    for (const Proxy& proxy : m_unbounded)
+    {
+        outColliders.push_back(proxy.collider);
+    }
+}
+
+void SweepAndPrune::addPair(const Proxy& a, const Proxy& b)
+{
+    if (a.id < b.id)
+    {
+        m_pairs.push_back({a.collider, b.collider, a.id, b.id, a.shape, b.shape});
+    }
+    else
+    {
+        m_pairs.push_back({b.collider, a.collider, b.id, a.id, b.shape, a.shape});
+    }
+}
+
+} // namespace collision
+} // namespace BulletPhysics
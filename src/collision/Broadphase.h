@@ -0,0 +1,76 @@
+/*
+ * Broadphase.h
+ */
+
+#pragma once
+
+#include "AABB.h"
+#include "Collider.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace BulletPhysics {
+namespace collision {
+
+// candidate pair for narrowphase, ordered so that idA < idB
+struct BroadphasePair {
+    Collider* colliderA;
+    Collider* colliderB;
+    uint32_t idA;
+    uint32_t idB;
+    CollisionShape shapeA;      // cached so narrowphase dispatch needs no virtual call
+    CollisionShape shapeB;
+};
+
+// incremental sweep and prune on single axis
+// proxies stay sorted between frames, so re-sorting coherent scenes is close to linear,
+// unbounded colliders (ground) are kept aside and tested against every finite proxy;
+// pair list is rebuilt by one sweep per update instead of kept across frames: with one sorted axis a kept set
+// would still recheck every pair overlapping on that axis each frame (others move freely), which is the work
+// the sweep does, plus hashing on every endpoint swap
+class SweepAndPrune {
+public:
+    explicit SweepAndPrune(int axis = 0);
+
+    void add(Collider* collider, uint32_t id);
+    void remove(Collider* collider);
+    void clear();
+
+    // sweep axis (0 = x, 1 = y, 2 = z)
+    void setAxis(int axis);
+    int getAxis() const { return m_axis; }
+
+    // refresh bounds and rebuild candidate pairs
+    const std::vector<BroadphasePair>& update();
+    const std::vector<BroadphasePair>& getPairs() const { return m_pairs; }
+
+    // colliders whose bounds (as of last update) overlap given box, unbounded ones always included
+    void query(const AABB& bounds, std::vector<Collider*>& outColliders) const;
+
+    size_t proxyCount() const { return m_proxies.size() + m_unbounded.size(); }
+
+private:
+    struct Proxy {
+        Collider* collider;
+        uint32_t id;
+        CollisionShape shape;
+        AABB bounds;
+    };
+
+    int m_axis;
+
+    std::vector<Proxy> m_proxies;       // sorted by bounds.min on sweep axis
+    std::vector<Proxy> m_unbounded;     // infinite extent on sweep axis
+    std::vector<BroadphasePair> m_pairs;
+    std::vector<BroadphasePair> m_pairScratch;  // radix sort buffer, swapped with m_pairs
+
+    bool m_sorted = true;   // false after insertion, first update falls back to full sort
+    float m_maxExtent = 0.0f;   // largest proxy size on sweep axis, bounds query window
+
+    void addPair(const Proxy& a, const Proxy& b);
+};
+
+} // namespace collision
+} // namespace BulletPhysics
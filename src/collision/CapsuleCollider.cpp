@@ -0,0 +1,291 @@
+/*
+ * CapsuleCollider.cpp
+ */
+
+#include "CapsuleCollider.h"
+
+#include "BoxCollider.h"
+#include "CylinderCollider.h"
+#include "Geometry.h"
+#include "GroundCollider.h"
+#include "HeightfieldCollider.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace BulletPhysics {
+namespace collision {
+
+namespace {
+
+// sphere samples along long capsule lying on fine terrain
+constexpr int MAX_HEIGHTFIELD_STEPS = 16;
+
+} // namespace
+
+CapsuleCollider::CapsuleCollider(float radius, float height) : m_radius(radius), m_height(height) {}
+
+void CapsuleCollider::getSegment(math::Vec3& outA, math::Vec3& outB) const
+{
+    math::Vec3 half = m_axis * getHalfSegment();
+    outA = m_position - half;
+    outB = m_position + half;
+}
+
+AABB CapsuleCollider::getBounds() const
+{
+    math::Vec3 a;
+    math::Vec3 b;
+    getSegment(a, b);
+
+    math::Vec3 extent{m_radius, m_radius, m_radius};
+    return {
+        math::Vec3{std::min(a.x, b.x), std::min(a.y, b.y), std::min(a.z, b.z)} - extent,
+        math::Vec3{std::max(a.x, b.x), std::max(a.y, b.y), std::max(a.z, b.z)} + extent
+    };
+}
+
+bool CapsuleCollider::testPoint(const math::Vec3& point) const
+{
+    math::Vec3 a;
+    math::Vec3 b;
+    getSegment(a, b);
+
+    math::Vec3 d = point - geometry::closestPointOnSegment(point, a, b);
+    return d.dot(d) <= m_radius * m_radius;
+}
+
+bool CapsuleCollider::testSegment(const math::Vec3& start, const math::Vec3& end, SweepInfo& outInfo) const
+{
+    return testSweptSphere(start, end, 0.0f, outInfo);
+}
+
+// swept sphere against capsule is segment against capsule of summed radius
+bool CapsuleCollider::testSweptSphere(const math::Vec3& start, const math::Vec3& end, float radius, SweepInfo& outInfo) const
+{
+    const float grown = m_radius + radius;
+
+    math::Vec3 a;
+    math::Vec3 b;
+    getSegment(a, b);
+
+    math::Vec3 delta = end - start;
+
+    math::Vec3 startOffset = start - geometry::closestPointOnSegment(start, a, b);
+    if (startOffset.dot(startOffset) <= grown * grown)
+    {
+        outInfo.time = 0.0f;
+        outInfo.point = start;
+        outInfo.normal = delta.normalized() * -1.0f;
+        return true;
+    }
+
+    float time;
+    if (!geometry::segmentCapsule(start, delta, a, b, grown, time))
+    {
+        return false;
+    }
+
+    math::Vec3 center = start + delta * time;
+    math::Vec3 closest = geometry::closestPointOnSegment(center, a, b);
+
+    outInfo.time = time;
+    outInfo.normal = (center - closest).normalized();
+    outInfo.point = closest + outInfo.normal * m_radius;
+    return true;
+}
+
+bool CapsuleCollider::testCollisionWithCapsule(const CapsuleCollider& capsule, CollisionInfo& outInfo) const
+{
+    math::Vec3 a1;
+    math::Vec3 b1;
+    math::Vec3 a2;
+    math::Vec3 b2;
+    getSegment(a1, b1);
+    capsule.getSegment(a2, b2);
+
+    math::Vec3 c1;
+    math::Vec3 c2;
+    geometry::closestPointsOnSegments(a1, b1, a2, b2, c1, c2);
+
+    // crossing segments separate along their common perpendicular
+    math::Vec3 fallback = m_axis.cross(capsule.m_axis);
+    fallback = fallback.dot(fallback) > geometry::GEOMETRY_EPSILON ? fallback.normalized() : geometry::perpendicular(m_axis);
+
+    return geometry::sphereContact(c1, m_radius, c2, capsule.m_radius, fallback, outInfo);
+}
+
+bool CapsuleCollider::testCollisionWithCylinder(const CylinderCollider& cylinder, CollisionInfo& outInfo) const
+{
+    const math::Vec3& axis = cylinder.getAxis();
+    const float halfHeight = cylinder.getHeight() * 0.5f;
+    const float halfSegment = getHalfSegment();
+
+    math::Vec3 a;
+    math::Vec3 b;
+    getSegment(a, b);
+
+    auto capsuleExtent = [&](const math::Vec3& n) { return geometry::capsuleExtent(m_axis, halfSegment, m_radius, n); };
+    auto cylinderExtent = [&](const math::Vec3& n) { return geometry::cylinderExtent(axis, halfHeight, cylinder.getRadius(), n); };
+
+    // closest points between capsule segment and cylinder axis give main contact direction
+    math::Vec3 c1;
+    math::Vec3 c2;
+    geometry::closestPointsOnSegments(a, b, cylinder.getPosition() - axis * halfHeight, cylinder.getPosition() + axis * halfHeight, c1, c2);
+    math::Vec3 between = c2 - c1;
+
+    // rim contacts of capsule ends and nearest segment point
+    auto rimAxis = [&](const math::Vec3& p)
+    {
+        return geometry::closestPointOnCylinder(p, cylinder.getPosition(), axis, halfHeight, cylinder.getRadius()) - p;
+    };
+
+    geometry::SeparatingAxes sat(cylinder.getPosition() - m_position);
+    if (!sat.test(axis, capsuleExtent, cylinderExtent)
+        || !sat.test(m_axis.cross(axis), capsuleExtent, cylinderExtent)
+        || !sat.test(between, capsuleExtent, cylinderExtent)
+        || !sat.test(between - axis * between.dot(axis), capsuleExtent, cylinderExtent)
+        || !sat.test(rimAxis(c1), capsuleExtent, cylinderExtent)
+        || !sat.test(rimAxis(a), capsuleExtent, cylinderExtent)
+        || !sat.test(rimAxis(b), capsuleExtent, cylinderExtent))
+    {
+        return false;
+    }
+
+    sat.write(outInfo);
+    return true;
+}
+
+// exact distance from segment to box when apart (end points against box, segment against 12 edges),
+// separating axes of segment and box faces when segment passes through box
+bool CapsuleCollider::testCollisionWithBox(const BoxCollider& box, CollisionInfo& outInfo) const
+{
+    const math::Vec3* axes = box.getAxes();
+    const math::Vec3 half = box.getSize() * 0.5f;
+    const float halfSegment = getHalfSegment();
+
+    // segment in box frame
+    math::Vec3 d = m_position - box.getPosition();
+    math::Vec3 center{d.dot(axes[0]), d.dot(axes[1]), d.dot(axes[2])};
+    math::Vec3 direction{m_axis.dot(axes[0]), m_axis.dot(axes[1]), m_axis.dot(axes[2])};
+    math::Vec3 a = center - direction * halfSegment;
+    math::Vec3 b = center + direction * halfSegment;
+
+    auto capsuleExtent = [&](const math::Vec3& n) { return geometry::capsuleExtent(m_axis, halfSegment, m_radius, n); };
+    auto boxExtent = [&](const math::Vec3& n) { return geometry::boxExtent(axes, half, n); };
+
+    if (!geometry::segmentOverlapsBox(a, b, half))
+    {
+        auto clampToBox = [&half](const math::Vec3& p)
+        {
+            return math::Vec3{std::clamp(p.x, -half.x, half.x), std::clamp(p.y, -half.y, half.y), std::clamp(p.z, -half.z, half.z)};
+        };
+
+        float minDistSq = std::numeric_limits<float>::infinity();
+        math::Vec3 onSegment;
+        math::Vec3 onBox;
+
+        auto consider = [&](const math::Vec3& s, const math::Vec3& p)
+        {
+            math::Vec3 diff = p - s;
+            float distSq = diff.dot(diff);
+            if (distSq < minDistSq)
+            {
+                minDistSq = distSq;
+                onSegment = s;
+                onBox = p;
+            }
+        };
+
+        consider(a, clampToBox(a));
+        consider(b, clampToBox(b));
+
+        // 4 edges parallel to each box axis
+        for (int corner = 0; corner < 4; corner++)
+        {
+            float u = (corner & 1) ? 1.0f : -1.0f;
+            float v = (corner & 2) ? 1.0f : -1.0f;
+
+            const math::Vec3 edges[3][2] = {
+                {{-half.x, u * half.y, v * half.z}, {half.x, u * half.y, v * half.z}},
+                {{u * half.x, -half.y, v * half.z}, {u * half.x, half.y, v * half.z}},
+                {{u * half.x, v * half.y, -half.z}, {u * half.x, v * half.y, half.z}}
+            };
+
+            for (const auto& edge : edges)
+            {
+                math::Vec3 s;
+                math::Vec3 p;
+                geometry::closestPointsOnSegments(a, b, edge[0], edge[1], s, p);
+                consider(s, p);
+            }
+        }
+
+        if (minDistSq > m_radius * m_radius)
+        {
+            return false;
+        }
+
+        if (minDistSq > 1e-12f)
+        {
+            float dist = std::sqrt(minDistSq);
+            math::Vec3 n = (onBox - onSegment) / dist;
+
+            outInfo.normal = axes[0] * n.x + axes[1] * n.y + axes[2] * n.z;
+            outInfo.penetration = m_radius - dist;
+            return true;
+        }
+    }
+
+    // segment touches or passes through box
+    geometry::SeparatingAxes sat(box.getPosition() - m_position);
+    for (int i = 0; i < 3; i++)
+    {
+        sat.test(axes[i], capsuleExtent, boxExtent);
+        sat.test(m_axis.cross(axes[i]), capsuleExtent, boxExtent);
+    }
+
+    sat.write(outInfo);
+    return true;
+}
+
+bool CapsuleCollider::testCollisionWithGround(const GroundCollider& ground, CollisionInfo& outInfo) const
+{
+    float lowestY = m_position.y - std::abs(m_axis.y) * getHalfSegment() - m_radius;
+    if (lowestY < ground.getGroundY())
+    {
+        outInfo.normal = math::Vec3{0.0f, 1.0f, 0.0f};
+        outInfo.penetration = ground.getGroundY() - lowestY;
+        return true;
+    }
+
+    return false;
+}
+
+bool CapsuleCollider::testCollisionWithHeightfield(const HeightfieldCollider& heightfield, CollisionInfo& outInfo) const
+{
+    math::Vec3 a, b;
+    getSegment(a, b);
+
+    // spheres along segment about one terrain cell apart, deepest contact wins
+    const float length = (b - a).length();
+    const int steps = std::clamp(static_cast<int>(std::ceil(length / heightfield.getCellSize())), 1, MAX_HEIGHTFIELD_STEPS);
+
+    bool hit = false;
+    outInfo.penetration = 0.0f;
+    for (int i = 0; i <= steps; i++)
+    {
+        CollisionInfo info;
+        const math::Vec3 center = a + (b - a) * (static_cast<float>(i) / static_cast<float>(steps));
+        if (heightfield.getSphereContact(center, m_radius, info) && info.penetration > outInfo.penetration)
+        {
+            outInfo = info;
+            hit = true;
+        }
+    }
+
+    return hit;
+}
+
+} // namespace collision
+} // namespace BulletPhysics
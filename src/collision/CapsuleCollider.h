@@ -0,0 +1,60 @@
+/*
+ * CapsuleCollider.h
+ */
+
+#pragma once
+
+#include "Collider.h"
+
+namespace BulletPhysics {
+namespace collision {
+
+class BoxCollider;
+class GroundCollider;
+class HeightfieldCollider;
+class CylinderCollider;
+
+// segment swept by sphere, height includes both caps (similar to CapsuleShape3D in Godot);
+// upright by default, suits people-sized targets
+class CapsuleCollider : public Collider {
+public:
+    explicit CapsuleCollider(float radius = 0.5f, float height = 2.0f);
+
+    CollisionShape getShape() const override { return CollisionShape::Capsule; }
+    const math::Vec3& getPosition() const override { return m_position; }
+    void setPosition(const math::Vec3& pos) override { m_position = pos; }
+
+    AABB getBounds() const override;
+
+    float getRadius() const { return m_radius; }
+    float getHeight() const { return m_height; }
+    void setRadius(float radius) { m_radius = radius; }
+    void setHeight(float height) { m_height = height; }
+
+    // unit direction of capsule segment
+    void setAxis(const math::Vec3& axis) { m_axis = axis.normalized(); }
+    const math::Vec3& getAxis() const { return m_axis; }
+
+    // half-length of inner segment and its end points
+    float getHalfSegment() const { return m_height * 0.5f > m_radius ? m_height * 0.5f - m_radius : 0.0f; }
+    void getSegment(math::Vec3& outA, math::Vec3& outB) const;
+
+    bool testPoint(const math::Vec3& point) const override;
+    bool testSegment(const math::Vec3& start, const math::Vec3& end, SweepInfo& outInfo) const override;
+    bool testSweptSphere(const math::Vec3& start, const math::Vec3& end, float radius, SweepInfo& outInfo) const override;
+
+    bool testCollisionWithCapsule(const CapsuleCollider& capsule, CollisionInfo& outInfo) const;
+    bool testCollisionWithCylinder(const CylinderCollider& cylinder, CollisionInfo& outInfo) const;
+    bool testCollisionWithBox(const BoxCollider& box, CollisionInfo& outInfo) const;
+    bool testCollisionWithGround(const GroundCollider& ground, CollisionInfo& outInfo) const;
+    bool testCollisionWithHeightfield(const HeightfieldCollider& heightfield, CollisionInfo& outInfo) const;
+
+private:
+    math::Vec3 m_position{};
+    math::Vec3 m_axis{0.0f, 1.0f, 0.0f};
+    float m_radius;
+    float m_height;
+};
+
+} // namespace collision
+} // namespace BulletPhysics
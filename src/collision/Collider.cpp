@@ -0,0 +1,18 @@
+/*
+ * Collider.cpp
+ */
+
+#include "Collider.h"
+#include "Narrowphase.h"
+
+namespace BulletPhysics {
+namespace collision {
+
+bool Collider::testCollision(const Collider& other, CollisionInfo& outInfo) const
+{
+    const NarrowphaseEntry& entry = Narrowphase::lookup(getShape(), other.getShape());
+    return entry.test && !entry.swapped && entry.test(*this, other, outInfo);
+}
+
+} // namespace collision
+} // namespace BulletPhysics
@@ -4,21 +4,40 @@
 
 #pragma once
 
+#include "AABB.h"
+#include "Material.h"
 #include "math/Vec3.h"
 
+#include <cstddef>
+
 namespace BulletPhysics {
 namespace collision {
 
 enum class CollisionShape {
     Box,
     Ground,
+    Heightfield,
+    Sphere,
+    Capsule,
+    Cylinder,
 };
 
+// size of narrowphase dispatch table, keep in sync with last shape
+inline constexpr size_t COLLISION_SHAPE_COUNT = static_cast<size_t>(CollisionShape::Cylinder) + 1;
+
+// normal points from first collider to second, against terrain (ground, heightfield) it is terrain surface normal
 struct CollisionInfo {
     float penetration = 0.0f;
     math::Vec3 normal{};
 };
 
+// first contact of segment moving from start to end
+struct SweepInfo {
+    float time = 1.0f;      // fraction of segment at contact [0, 1], 0 when start is inside
+    math::Vec3 point{};
+    math::Vec3 normal{};    // surface normal at contact, opposes motion
+};
+
 class Collider {
 public:
     virtual ~Collider() = default;
@@ -27,8 +46,27 @@ public:
     virtual const math::Vec3& getPosition() const = 0;
     virtual void setPosition(const math::Vec3& pos) = 0;
 
-    virtual bool testCollision(const Collider& other, CollisionInfo& outInfo) const = 0;
+    // world-space bounds for broadphase
+    virtual AABB getBounds() const = 0;
+
+    // discrete overlap test through narrowphase table, false when pair test is registered
+    // the other way around (ground vs box), in that case other collider owns the test
+    bool testCollision(const Collider& other, CollisionInfo& outInfo) const;
     virtual bool testPoint(const math::Vec3& point) const = 0;
+
+    // continuous test of segment (swept point) against collider
+    virtual bool testSegment(const math::Vec3& start, const math::Vec3& end, SweepInfo& outInfo) const = 0;
+
+    // continuous test of sphere with given radius moving from start to end (sized projectile),
+    // point is contact on collider surface, radius 0 matches testSegment
+    virtual bool testSweptSphere(const math::Vec3& start, const math::Vec3& end, float radius, SweepInfo& outInfo) const = 0;
+
+    // surface material for impact response
+    const Material& getMaterial() const { return m_material; }
+    void setMaterial(const Material& material) { m_material = material; }
+
+private:
+    Material m_material;
 };
 
 } // namespace collision
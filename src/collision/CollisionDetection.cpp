@@ -7,12 +7,18 @@
 namespace BulletPhysics {
 namespace collision {
 
-void CollisionDetection::addCollider(Collider* collider)
+uint32_t CollisionDetection::addCollider(Collider* collider)
 {
-    if (collider)
+    if (!collider)
     {
-        m_colliders.push_back(collider);
+        return INVALID_COLLIDER_ID;
     }
+
+    m_colliders.push_back(collider);
+    m_byId.push_back(collider);
+    m_pools[static_cast<size_t>(collider->getShape())].push_back({collider, m_nextId});
+    m_broadphase.add(collider, m_nextId);
+    return m_nextId++;
 }
 
 void CollisionDetection::removeCollider(Collider* collider)
@@ -21,37 +27,235 @@ void CollisionDetection::removeCollider(Collider* collider)
     if (it != m_colliders.end())
     {
         m_colliders.erase(it);
+        m_broadphase.remove(collider);
+        std::replace(m_byId.begin(), m_byId.end(), collider, static_cast<Collider*>(nullptr));
+
+        std::vector<PoolEntry>& pool = m_pools[static_cast<size_t>(collider->getShape())];
+        pool.erase(std::find_if(pool.begin(), pool.end(), [collider](const PoolEntry& entry) { return entry.collider == collider; }));
     }
 }
 
 void CollisionDetection::clear()
 {
     m_colliders.clear();
+    m_byId.clear();
+    for (auto& pool : m_pools)
+    {
+        pool.clear();
+    }
+    m_broadphase.clear();
+    m_nextId = 0;
+}
+
+void CollisionDetection::setThreadCount(size_t count)
+{
+    if (count == getThreadCount())
+    {
+        return;
+    }
+
+    m_threadPool = count > 1 ? std::make_unique<ThreadPool>(count) : nullptr;
+    m_threadManifolds.resize(count > 1 ? count : 0);
 }
 
 void CollisionDetection::detect(std::vector<Manifold>& manifolds)
 {
     manifolds.clear();
 
-    for (size_t i = 0; i < m_colliders.size(); i++)
+    if (m_broadphaseEnabled)
+    {
+        detectBroadphase(manifolds);
+    }
+    else
+    {
+        detectAllPairs(manifolds);
+    }
+}
+
+void CollisionDetection::detectBroadphase(std::vector<Manifold>& manifolds)
+{
+    // pairs come ordered by ids already
+    const std::vector<BroadphasePair>& pairs = m_broadphase.update();
+
+    auto testRange = [&pairs](size_t begin, size_t end, std::vector<Manifold>& out)
     {
-        for (size_t j = i + 1; j < m_colliders.size(); j++)
+        for (size_t i = begin; i < end; i++)
         {
-            Collider* a = m_colliders[i];
-            Collider* b = m_colliders[j];
+            const BroadphasePair& pair = pairs[i];
+            const NarrowphaseEntry& entry = Narrowphase::lookup(pair.shapeA, pair.shapeB);
+            if (entry.test)
+            {
+                testPair(entry, {pair.colliderA, pair.idA}, {pair.colliderB, pair.idB}, out);
+            }
+        }
+    };
 
-            CollisionInfo info;
-            if (a->testCollision(*b, info))
+    if (!m_threadPool)
+    {
+        testRange(0, pairs.size(), manifolds);
+        return;
+    }
+
+    // contiguous ranges keep id order, so concatenation needs no sort
+    const size_t threads = m_threadManifolds.size();
+    m_threadPool->run(threads, [&](size_t thread)
+    {
+        std::vector<Manifold>& out = m_threadManifolds[thread];
+        out.clear();
+        testRange(pairs.size() * thread / threads, pairs.size() * (thread + 1) / threads, out);
+    });
+
+    mergeThreadManifolds(manifolds);
+}
+
+void CollisionDetection::detectAllPairs(std::vector<Manifold>& manifolds)
+{
+    if (!m_threadPool)
+    {
+        testRows(0, 1, manifolds);
+    }
+    else
+    {
+        // rows interleaved between threads, triangular blocks get even share of pairs
+        const size_t threads = m_threadManifolds.size();
+        m_threadPool->run(threads, [&](size_t thread)
+        {
+            std::vector<Manifold>& out = m_threadManifolds[thread];
+            out.clear();
+            testRows(thread, threads, out);
+        });
+
+        mergeThreadManifolds(manifolds);
+    }
+
+    // back to insertion pair order, same as broadphase path
+    std::sort(manifolds.begin(), manifolds.end(), [](const Manifold& lhs, const Manifold& rhs)
+    {
+        const uint32_t lhsLow = std::min(lhs.idA, lhs.idB);
+        const uint32_t rhsLow = std::min(rhs.idA, rhs.idB);
+        if (lhsLow != rhsLow)
+        {
+            return lhsLow < rhsLow;
+        }
+        return std::max(lhs.idA, lhs.idB) < std::max(rhs.idA, rhs.idB);
+    });
+}
+
+void CollisionDetection::testRows(size_t offset, size_t stride, std::vector<Manifold>& manifolds) const
+{
+    // one block per shape pair with registered test, unregistered blocks are skipped whole
+    size_t row = 0;
+    for (size_t shapeA = 0; shapeA < COLLISION_SHAPE_COUNT; shapeA++)
+    {
+        for (size_t shapeB = shapeA; shapeB < COLLISION_SHAPE_COUNT; shapeB++)
+        {
+            const NarrowphaseEntry& entry = Narrowphase::lookup(static_cast<CollisionShape>(shapeA), static_cast<CollisionShape>(shapeB));
+            if (!entry.test)
             {
-                manifolds.push_back({a, b, info});
+                continue;
             }
-            else if (b->testCollision(*a, info))
+
+            const std::vector<PoolEntry>& poolA = m_pools[shapeA];
+            const std::vector<PoolEntry>& poolB = m_pools[shapeB];
+
+            // first row of this block owned by offset
+            size_t i = (offset + stride - row % stride) % stride;
+            row += poolA.size();
+
+            for (; i < poolA.size(); i += stride)
             {
-                manifolds.push_back({b, a, info});
+                for (size_t j = shapeA == shapeB ? i + 1 : 0; j < poolB.size(); j++)
+                {
+                    testPair(entry, poolA[i], poolB[j], manifolds);
+                }
             }
         }
     }
 }
 
+void CollisionDetection::mergeThreadManifolds(std::vector<Manifold>& manifolds)
+{
+    size_t total = 0;
+    for (const std::vector<Manifold>& buffer : m_threadManifolds)
+    {
+        total += buffer.size();
+    }
+
+    manifolds.reserve(total);
+    for (const std::vector<Manifold>& buffer : m_threadManifolds)
+    {
+        manifolds.insert(manifolds.end(), buffer.begin(), buffer.end());
+    }
+}
+
+bool CollisionDetection::sweep(const math::Vec3& start, const math::Vec3& end, SweepHit& outHit)
+{
+    bool hit = false;
+    outHit.info.time = 1.0f;
+
+    for (Collider* collider : gatherSweepCandidates(start, end, 0.0f))
+    {
+        SweepInfo info;
+        if (collider->testSegment(start, end, info) && (!hit || info.time < outHit.info.time))
+        {
+            hit = true;
+            outHit.collider = collider;
+            outHit.info = info;
+        }
+    }
+
+    return hit;
+}
+
+bool CollisionDetection::sweepSphere(const math::Vec3& start, const math::Vec3& end, float radius, SweepHit& outHit)
+{
+    bool hit = false;
+    outHit.info.time = 1.0f;
+
+    for (Collider* collider : gatherSweepCandidates(start, end, radius))
+    {
+        SweepInfo info;
+        if (collider->testSweptSphere(start, end, radius, info) && (!hit || info.time < outHit.info.time))
+        {
+            hit = true;
+            outHit.collider = collider;
+            outHit.info = info;
+        }
+    }
+
+    return hit;
+}
+
+const std::vector<Collider*>& CollisionDetection::gatherSweepCandidates(const math::Vec3& start, const math::Vec3& end, float radius)
+{
+    if (!m_broadphaseEnabled)
+    {
+        return m_colliders;
+    }
+
+    math::Vec3 grow{radius, radius, radius};
+    AABB bounds{
+        math::Vec3{std::min(start.x, end.x), std::min(start.y, end.y), std::min(start.z, end.z)} - grow,
+        math::Vec3{std::max(start.x, end.x), std::max(start.y, end.y), std::max(start.z, end.z)} + grow
+    };
+
+    m_sweepCandidates.clear();
+    m_broadphase.query(bounds, m_sweepCandidates);
+    return m_sweepCandidates;
+}
+
+void CollisionDetection::testPair(const NarrowphaseEntry& entry, const PoolEntry& a, const PoolEntry& b, std::vector<Manifold>& manifolds)
+{
+    // manifold keeps colliders in order the test was registered with
+    const PoolEntry& first = entry.swapped ? b : a;
+    const PoolEntry& second = entry.swapped ? a : b;
+
+    CollisionInfo info;
+    if (entry.test(*first.collider, *second.collider, info))
+    {
+        manifolds.push_back({first.collider, second.collider, info, first.id, second.id});
+    }
+}
+
 } // namespace collision
 } // namespace BulletPhysics
@@ -5,30 +5,126 @@
 #pragma once
 
 #include "Collider.h"
+#include "Broadphase.h"
+#include "Narrowphase.h"
+#include "ThreadPool.h"
 
+#include <array>
 #include <vector>
 #include <memory>
 #include <algorithm>
+#include <cstdint>
 
 namespace BulletPhysics {
 namespace collision {
 
+// returned by addCollider for null collider
+inline constexpr uint32_t INVALID_COLLIDER_ID = UINT32_MAX;
+
 struct Manifold {
     Collider* colliderA;
     Collider* colliderB;
     CollisionInfo info;
+    uint32_t idA = 0;   // ids assigned by addCollider, in insertion order
+    uint32_t idB = 0;
+};
+
+struct SweepHit {
+    Collider* collider = nullptr;
+    SweepInfo info;
 };
 
 class CollisionDetection {
 public:
-    void addCollider(Collider* collider);
+    // returns id used in manifolds (idA, idB), ids restart from 0 after clear()
+    uint32_t addCollider(Collider* collider);
     void removeCollider(Collider* collider);
     void clear();
 
+    // collider by id from addCollider, null once removed
+    Collider* getCollider(uint32_t id) const { return id < m_byId.size() ? m_byId[id] : nullptr; }
+
+    // fn(collider, id) for every collider, grouped by shape
+    template <typename Fn>
+    void forEachCollider(Fn&& fn) const
+    {
+        for (const auto& pool : m_pools)
+        {
+            for (const PoolEntry& entry : pool)
+            {
+                fn(*entry.collider, entry.id);
+            }
+        }
+    }
+
+    size_t colliderCount() const { return m_colliders.size(); }
+
+    // move every collider by -shift after floating origin moved by shift (ground keeps its height in new frame),
+    // broadphase picks new bounds up on next detect(); Simulation::rebase calls it for its attached detection
+    void shiftOrigin(const math::Vec3& shift)
+    {
+        for (Collider* collider : m_colliders)
+        {
+            collider->setPosition(collider->getPosition() - shift);
+        }
+    }
+
+    // broadphase culling (enabled by default), disabled falls back to testing all pairs
+    void setBroadphaseEnabled(bool enabled) { m_broadphaseEnabled = enabled; }
+    bool isBroadphaseEnabled() const { return m_broadphaseEnabled; }
+
+    SweepAndPrune& getBroadphase() { return m_broadphase; }
+
+    // narrowphase threads (1 = serial, default), candidate pairs are split into one contiguous
+    // range per thread with its own manifold buffer, merged result is identical to serial path
+    void setThreadCount(size_t count);
+    size_t getThreadCount() const { return m_threadPool ? m_threadPool->size() : 1; }
+
+    // each candidate pair is tested once through narrowphase table,
+    // manifolds come ordered by (lower id, higher id) of their colliders
     void detect(std::vector<Manifold>& manifolds);
 
+    // earliest hit of segment from start to end (continuous detection for fast projectiles),
+    // with broadphase enabled candidates come from bounds refreshed by last detect()
+    bool sweep(const math::Vec3& start, const math::Vec3& end, SweepHit& outHit);
+
+    // earliest hit of sphere with given radius moving from start to end
+    bool sweepSphere(const math::Vec3& start, const math::Vec3& end, float radius, SweepHit& outHit);
+
 private:
+    struct PoolEntry {
+        Collider* collider;
+        uint32_t id;
+    };
+
     std::vector<Collider*> m_colliders;
+    std::vector<Collider*> m_byId;      // indexed by id
+    // pointer and id of colliders grouped by shape so all-pairs path walks shape blocks; colliders stay caller-owned,
+    // so shape data itself is not contiguous
+    std::array<std::vector<PoolEntry>, COLLISION_SHAPE_COUNT> m_pools;
+
+    SweepAndPrune m_broadphase;
+    bool m_broadphaseEnabled = true;
+    uint32_t m_nextId = 0;
+
+    std::vector<Collider*> m_sweepCandidates;     // reused between sweep queries
+
+    std::unique_ptr<ThreadPool> m_threadPool;
+    std::vector<std::vector<Manifold>> m_threadManifolds;   // one per thread, kept between frames
+
+    void detectBroadphase(std::vector<Manifold>& manifolds);
+    void detectAllPairs(std::vector<Manifold>& manifolds);
+
+    // all-pairs rows (one collider against rest of its shape block) with index % stride == offset
+    void testRows(size_t offset, size_t stride, std::vector<Manifold>& manifolds) const;
+
+    // concatenate thread buffers in thread order
+    void mergeThreadManifolds(std::vector<Manifold>& manifolds);
+
+    // colliders possibly touched by segment grown by radius
+    const std::vector<Collider*>& gatherSweepCandidates(const math::Vec3& start, const math::Vec3& end, float radius);
+
+    static void testPair(const NarrowphaseEntry& entry, const PoolEntry& a, const PoolEntry& b, std::vector<Manifold>& manifolds);
 };
 
 } // namespace collision
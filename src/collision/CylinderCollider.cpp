@@ -0,0 +1,187 @@
+/*
+ * CylinderCollider.cpp
+ */
+
+#include "CylinderCollider.h"
+
+#include "BoxCollider.h"
+#include "Geometry.h"
+#include "GroundCollider.h"
+#include "HeightfieldCollider.h"
+
+namespace BulletPhysics {
+namespace collision {
+
+CylinderCollider::CylinderCollider(float radius, float height) : m_radius(radius), m_height(height) {}
+
+AABB CylinderCollider::getBounds() const
+{
+    const float halfHeight = m_height * 0.5f;
+
+    // per world axis: projected half-height plus disc radius
+    auto extent = [&](float c) { return halfHeight * std::abs(c) + m_radius * std::sqrt(std::max(0.0f, 1.0f - c * c)); };
+    math::Vec3 half{extent(m_axis.x), extent(m_axis.y), extent(m_axis.z)};
+
+    return {m_position - half, m_position + half};
+}
+
+bool CylinderCollider::testPoint(const math::Vec3& point) const
+{
+    math::Vec3 m = point - m_position;
+    float h = m.dot(m_axis);
+    math::Vec3 radial = m - m_axis * h;
+
+    return std::abs(h) <= m_height * 0.5f && radial.dot(radial) <= m_radius * m_radius;
+}
+
+bool CylinderCollider::testSegment(const math::Vec3& start, const math::Vec3& end, SweepInfo& outInfo) const
+{
+    return testSweptSphere(start, end, 0.0f, outInfo);
+}
+
+bool CylinderCollider::testSweptSphere(const math::Vec3& start, const math::Vec3& end, float radius, SweepInfo& outInfo) const
+{
+    math::Vec3 delta = end - start;
+
+    float t;
+    math::Vec3 normal;
+    if (!geometry::segmentCylinder(start, delta, m_position, m_axis, m_height * 0.5f + radius, m_radius + radius, t, normal))
+    {
+        return false;
+    }
+
+    outInfo.time = t;
+    outInfo.normal = normal;
+    outInfo.point = t > 0.0f ? start + delta * t - normal * radius : start;
+    return true;
+}
+
+bool CylinderCollider::testCollisionWithCylinder(const CylinderCollider& cylinder, CollisionInfo& outInfo) const
+{
+    const float halfHeightA = m_height * 0.5f;
+    const float halfHeightB = cylinder.m_height * 0.5f;
+    const math::Vec3& axisA = m_axis;
+    const math::Vec3& axisB = cylinder.m_axis;
+
+    auto extentA = [&](const math::Vec3& n) { return geometry::cylinderExtent(axisA, halfHeightA, m_radius, n); };
+    auto extentB = [&](const math::Vec3& n) { return geometry::cylinderExtent(axisB, halfHeightB, cylinder.m_radius, n); };
+
+    // closest points of axis segments, and rim points nearest to them
+    math::Vec3 c1;
+    math::Vec3 c2;
+    geometry::closestPointsOnSegments(m_position - axisA * halfHeightA, m_position + axisA * halfHeightA,
+                                      cylinder.m_position - axisB * halfHeightB, cylinder.m_position + axisB * halfHeightB, c1, c2);
+    math::Vec3 between = c2 - c1;
+
+    // walked from both sides so result does not depend on argument order
+    math::Vec3 rimA = geometry::closestPointOnCylinder(c2, m_position, axisA, halfHeightA, m_radius);
+    math::Vec3 rimB = geometry::closestPointOnCylinder(rimA, cylinder.m_position, axisB, halfHeightB, cylinder.m_radius);
+    math::Vec3 otherRimB = geometry::closestPointOnCylinder(c1, cylinder.m_position, axisB, halfHeightB, cylinder.m_radius);
+    math::Vec3 otherRimA = geometry::closestPointOnCylinder(otherRimB, m_position, axisA, halfHeightA, m_radius);
+
+    geometry::SeparatingAxes sat(cylinder.m_position - m_position);
+    if (!sat.test(axisA, extentA, extentB)
+        || !sat.test(axisB, extentA, extentB)
+        || !sat.test(axisA.cross(axisB), extentA, extentB)
+        || !sat.test(between, extentA, extentB)
+        || !sat.test(between - axisA * between.dot(axisA), extentA, extentB)
+        || !sat.test(between - axisB * between.dot(axisB), extentA, extentB)
+        || !sat.test(rimB - rimA, extentA, extentB)
+        || !sat.test(otherRimB - otherRimA, extentA, extentB))
+    {
+        return false;
+    }
+
+    sat.write(outInfo);
+    return true;
+}
+
+bool CylinderCollider::testCollisionWithBox(const BoxCollider& box, CollisionInfo& outInfo) const
+{
+    const math::Vec3* axes = box.getAxes();
+    const math::Vec3 half = box.getSize() * 0.5f;
+    const float halfHeight = m_height * 0.5f;
+
+    auto cylinderExtent = [&](const math::Vec3& n) { return geometry::cylinderExtent(m_axis, halfHeight, m_radius, n); };
+    auto boxExtent = [&](const math::Vec3& n) { return geometry::boxExtent(axes, half, n); };
+
+    // box point nearest to cylinder center, its radial offset catches side contacts against box edges
+    math::Vec3 d = m_position - box.getPosition();
+    math::Vec3 nearest = box.getPosition()
+        + axes[0] * std::clamp(d.dot(axes[0]), -half.x, half.x)
+        + axes[1] * std::clamp(d.dot(axes[1]), -half.y, half.y)
+        + axes[2] * std::clamp(d.dot(axes[2]), -half.z, half.z);
+    math::Vec3 toNearest = nearest - m_position;
+
+    geometry::SeparatingAxes sat(box.getPosition() - m_position);
+    if (!sat.test(m_axis, cylinderExtent, boxExtent))
+    {
+        return false;
+    }
+
+    for (int i = 0; i < 3; i++)
+    {
+        if (!sat.test(axes[i], cylinderExtent, boxExtent) || !sat.test(m_axis.cross(axes[i]), cylinderExtent, boxExtent))
+        {
+            return false;
+        }
+    }
+
+    if (!sat.test(toNearest - m_axis * toNearest.dot(m_axis), cylinderExtent, boxExtent))
+    {
+        return false;
+    }
+
+    sat.write(outInfo);
+    return true;
+}
+
+bool CylinderCollider::testCollisionWithGround(const GroundCollider& ground, CollisionInfo& outInfo) const
+{
+    // lowest point: axis end plus disc radius along steepest downward direction
+    float c = m_axis.y;
+    float lowestY = m_position.y - m_height * 0.5f * std::abs(c) - m_radius * std::sqrt(std::max(0.0f, 1.0f - c * c));
+
+    if (lowestY < ground.getGroundY())
+    {
+        outInfo.normal = math::Vec3{0.0f, 1.0f, 0.0f};
+        outInfo.penetration = ground.getGroundY() - lowestY;
+        return true;
+    }
+
+    return false;
+}
+
+bool CylinderCollider::testCollisionWithHeightfield(const HeightfieldCollider& heightfield, CollisionInfo& outInfo) const
+{
+    bool hit = false;
+    outInfo.penetration = 0.0f;
+
+    // on flat terrain deepest point of cylinder is on rim of one cap, disc radius along steepest direction into surface
+    for (float side : {-0.5f, 0.5f})
+    {
+        const math::Vec3 cap = m_position + m_axis * (m_height * side);
+
+        math::Vec3 normal;
+        if (!heightfield.getNormal(cap.x, cap.z, normal))
+        {
+            continue;
+        }
+
+        const math::Vec3 across = normal - m_axis * normal.dot(m_axis);
+        const float acrossLength = across.length();
+        const math::Vec3 rim = acrossLength > 1e-6f ? cap - across * (m_radius / acrossLength) : cap;
+
+        CollisionInfo info;
+        if (heightfield.getSphereContact(rim, 0.0f, info) && info.penetration > outInfo.penetration)
+        {
+            outInfo = info;
+            hit = true;
+        }
+    }
+
+    return hit;
+}
+
+} // namespace collision
+} // namespace BulletPhysics
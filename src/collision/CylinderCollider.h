@@ -0,0 +1,56 @@
+/*
+ * CylinderCollider.h
+ */
+
+#pragma once
+
+#include "Collider.h"
+
+namespace BulletPhysics {
+namespace collision {
+
+class BoxCollider;
+class GroundCollider;
+class HeightfieldCollider;
+
+// solid cylinder centered at position (similar to CylinderShape3D in Godot), upright by default, suits posts and poles
+class CylinderCollider : public Collider {
+public:
+    explicit CylinderCollider(float radius = 0.5f, float height = 2.0f);
+
+    CollisionShape getShape() const override { return CollisionShape::Cylinder; }
+    const math::Vec3& getPosition() const override { return m_position; }
+    void setPosition(const math::Vec3& pos) override { m_position = pos; }
+
+    AABB getBounds() const override;
+
+    float getRadius() const { return m_radius; }
+    float getHeight() const { return m_height; }
+    void setRadius(float radius) { m_radius = radius; }
+    void setHeight(float height) { m_height = height; }
+
+    // unit direction of cylinder axis
+    void setAxis(const math::Vec3& axis) { m_axis = axis.normalized(); }
+    const math::Vec3& getAxis() const { return m_axis; }
+
+    bool testPoint(const math::Vec3& point) const override;
+    bool testSegment(const math::Vec3& start, const math::Vec3& end, SweepInfo& outInfo) const override;
+
+    // cylinder grown by radius on sides and caps, rounded rims are approximated by sharp ones
+    bool testSweptSphere(const math::Vec3& start, const math::Vec3& end, float radius, SweepInfo& outInfo) const override;
+
+    // support-projection tests on candidate axes (no closed form for cylinder pairs)
+    bool testCollisionWithCylinder(const CylinderCollider& cylinder, CollisionInfo& outInfo) const;
+    bool testCollisionWithBox(const BoxCollider& box, CollisionInfo& outInfo) const;
+    bool testCollisionWithGround(const GroundCollider& ground, CollisionInfo& outInfo) const;
+    bool testCollisionWithHeightfield(const HeightfieldCollider& heightfield, CollisionInfo& outInfo) const;
+
+private:
+    math::Vec3 m_position{};
+    math::Vec3 m_axis{0.0f, 1.0f, 0.0f};
+    float m_radius;
+    float m_height;
+};
+
+} // namespace collision
+} // namespace BulletPhysics
@@ -0,0 +1,389 @@
+/*
+ * Geometry.h
+ */
+
+#pragma once
+
+#include "Collider.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace BulletPhysics {
+namespace collision {
+namespace geometry {
+
+// squared lengths below this are treated as zero (degenerate segments, parallel axes)
+inline constexpr float GEOMETRY_EPSILON = 1e-8f;
+
+// closest point to p on segment ab
+inline math::Vec3 closestPointOnSegment(const math::Vec3& p, const math::Vec3& a, const math::Vec3& b)
+{
+    math::Vec3 ab = b - a;
+    float lengthSq = ab.dot(ab);
+    if (lengthSq < GEOMETRY_EPSILON)
+    {
+        return a;
+    }
+
+    float t = std::clamp((p - a).dot(ab) / lengthSq, 0.0f, 1.0f);
+    return a + ab * t;
+}
+
+// closest points between segments p1q1 and p2q2 (Ericson, Real-Time Collision Detection, 5.1.9)
+inline void closestPointsOnSegments(const math::Vec3& p1, const math::Vec3& q1, const math::Vec3& p2, const math::Vec3& q2,
+                                    math::Vec3& outC1, math::Vec3& outC2)
+{
+    math::Vec3 d1 = q1 - p1;
+    math::Vec3 d2 = q2 - p2;
+    math::Vec3 r = p1 - p2;
+
+    float a = d1.dot(d1);
+    float e = d2.dot(d2);
+    float f = d2.dot(r);
+
+    float s = 0.0f;
+    float t = 0.0f;
+
+    if (a < GEOMETRY_EPSILON && e < GEOMETRY_EPSILON)
+    {
+        // both segments are points
+    }
+    else if (a < GEOMETRY_EPSILON)
+    {
+        t = std::clamp(f / e, 0.0f, 1.0f);
+    }
+    else
+    {
+        float c = d1.dot(r);
+        if (e < GEOMETRY_EPSILON)
+        {
+            s = std::clamp(-c / a, 0.0f, 1.0f);
+        }
+        else
+        {
+            float b = d1.dot(d2);
+            float denom = a * e - b * b;
+
+            // parallel segments pick any s, t follows
+            s = denom > GEOMETRY_EPSILON ? std::clamp((b * f - c * e) / denom, 0.0f, 1.0f) : 0.0f;
+            t = (b * s + f) / e;
+
+            if (t < 0.0f)
+            {
+                t = 0.0f;
+                s = std::clamp(-c / a, 0.0f, 1.0f);
+            }
+            else if (t > 1.0f)
+            {
+                t = 1.0f;
+                s = std::clamp((b - c) / a, 0.0f, 1.0f);
+            }
+        }
+    }
+
+    outC1 = p1 + d1 * s;
+    outC2 = p2 + d2 * t;
+}
+
+// any unit vector perpendicular to v
+inline math::Vec3 perpendicular(const math::Vec3& v)
+{
+    math::Vec3 other = std::abs(v.x) < 0.9f ? math::Vec3{1.0f, 0.0f, 0.0f} : math::Vec3{0.0f, 1.0f, 0.0f};
+    return v.cross(other).normalized();
+}
+
+// closest point to p on solid finite cylinder, p itself when inside
+inline math::Vec3 closestPointOnCylinder(const math::Vec3& p, const math::Vec3& center, const math::Vec3& axis, float halfHeight, float radius)
+{
+    math::Vec3 m = p - center;
+    float h = m.dot(axis);
+    math::Vec3 radial = m - axis * h;
+    float radialLength = radial.length();
+
+    math::Vec3 closest = center + axis * std::clamp(h, -halfHeight, halfHeight);
+    if (radialLength > radius)
+    {
+        return closest + radial * (radius / radialLength);
+    }
+    return closest + radial;
+}
+
+// overlap of spheres at a and b, normal points from a to b (fallback when centers coincide)
+inline bool sphereContact(const math::Vec3& a, float radiusA, const math::Vec3& b, float radiusB, const math::Vec3& fallback, CollisionInfo& outInfo)
+{
+    math::Vec3 d = b - a;
+    float distSq = d.dot(d);
+    float radius = radiusA + radiusB;
+
+    if (distSq > radius * radius)
+    {
+        return false;
+    }
+
+    float dist = std::sqrt(distSq);
+    outInfo.normal = dist > 1e-6f ? d / dist : fallback;
+    outInfo.penetration = radius - dist;
+    return true;
+}
+
+// first t in [0, 1] where start + delta * t touches sphere, t = 0 when start is inside
+inline bool segmentSphere(const math::Vec3& start, const math::Vec3& delta, const math::Vec3& center, float radius, float& outT)
+{
+    math::Vec3 m = start - center;
+    float c = m.dot(m) - radius * radius;
+    if (c <= 0.0f)
+    {
+        outT = 0.0f;
+        return true;
+    }
+
+    // outside and moving away
+    float b = m.dot(delta);
+    float a = delta.dot(delta);
+    if (b >= 0.0f || a < GEOMETRY_EPSILON)
+    {
+        return false;
+    }
+
+    float disc = b * b - a * c;
+    if (disc < 0.0f)
+    {
+        return false;
+    }
+
+    float t = (-b - std::sqrt(disc)) / a;
+    if (t > 1.0f)
+    {
+        return false;
+    }
+
+    outT = t;
+    return true;
+}
+
+// first t in [0, 1] where start + delta * t enters finite cylinder (side or caps) and entry normal,
+// start inside gives t = 0 and normal opposing motion
+inline bool segmentCylinder(const math::Vec3& start, const math::Vec3& delta, const math::Vec3& center, const math::Vec3& axis,
+                            float halfHeight, float radius, float& outT, math::Vec3& outNormal)
+{
+    math::Vec3 m = start - center;
+    float mh = m.dot(axis);
+    float dh = delta.dot(axis);
+
+    // radial components
+    math::Vec3 mr = m - axis * mh;
+    math::Vec3 dr = delta - axis * dh;
+
+    if (std::abs(mh) <= halfHeight && mr.dot(mr) <= radius * radius)
+    {
+        outT = 0.0f;
+        outNormal = delta.normalized() * -1.0f;
+        return true;
+    }
+
+    float tEnter = -std::numeric_limits<float>::infinity();
+    float tExit = std::numeric_limits<float>::infinity();
+    math::Vec3 enterNormal{};
+
+    // slab between caps
+    if (std::abs(dh) < GEOMETRY_EPSILON)
+    {
+        if (std::abs(mh) > halfHeight)
+        {
+            return false;
+        }
+    }
+    else
+    {
+        float t1 = (-halfHeight - mh) / dh;
+        float t2 = (halfHeight - mh) / dh;
+        if (t1 > t2)
+        {
+            std::swap(t1, t2);
+        }
+
+        tEnter = t1;
+        tExit = t2;
+        enterNormal = dh > 0.0f ? axis * -1.0f : axis;
+    }
+
+    // infinite side: |mr + dr * t| = radius
+    float a = dr.dot(dr);
+    float b = mr.dot(dr);
+    float c = mr.dot(mr) - radius * radius;
+
+    if (a < GEOMETRY_EPSILON)
+    {
+        if (c > 0.0f)
+        {
+            return false;
+        }
+    }
+    else
+    {
+        float disc = b * b - a * c;
+        if (disc < 0.0f)
+        {
+            return false;
+        }
+
+        float root = std::sqrt(disc);
+        float t1 = (-b - root) / a;
+        float t2 = (-b + root) / a;
+
+        if (t1 > tEnter)
+        {
+            tEnter = t1;
+            enterNormal = (mr + dr * t1) / radius;
+        }
+        tExit = std::min(tExit, t2);
+    }
+
+    if (tEnter > tExit || tEnter > 1.0f || tExit < 0.0f)
+    {
+        return false;
+    }
+
+    outT = std::max(tEnter, 0.0f);
+    outNormal = enterNormal;
+    return true;
+}
+
+// first t in [0, 1] where start + delta * t touches capsule around segment ab (end spheres and side, its caps lie inside end spheres)
+inline bool segmentCapsule(const math::Vec3& start, const math::Vec3& delta, const math::Vec3& a, const math::Vec3& b, float radius, float& outT)
+{
+    bool hit = false;
+    float time = 1.0f;
+
+    float t;
+    if (segmentSphere(start, delta, a, radius, t) && t <= time)
+    {
+        hit = true;
+        time = t;
+    }
+    if (segmentSphere(start, delta, b, radius, t) && t <= time)
+    {
+        hit = true;
+        time = t;
+    }
+
+    math::Vec3 ab = b - a;
+    float length = ab.length();
+    math::Vec3 normal;
+    if (length > 1e-6f && segmentCylinder(start, delta, (a + b) * 0.5f, ab / length, length * 0.5f, radius, t, normal) && t <= time)
+    {
+        hit = true;
+        time = t;
+    }
+
+    outT = time;
+    return hit;
+}
+
+// slab test of segment ab against axis-aligned box [-half, half]
+inline bool segmentOverlapsBox(const math::Vec3& a, const math::Vec3& b, const math::Vec3& half)
+{
+    const float start[3] = {a.x, a.y, a.z};
+    const float delta[3] = {b.x - a.x, b.y - a.y, b.z - a.z};
+    const float extent[3] = {half.x, half.y, half.z};
+
+    float tEnter = 0.0f;
+    float tExit = 1.0f;
+
+    for (int i = 0; i < 3; i++)
+    {
+        if (std::abs(delta[i]) < GEOMETRY_EPSILON)
+        {
+            if (std::abs(start[i]) > extent[i])
+            {
+                return false;
+            }
+            continue;
+        }
+
+        float t1 = (-extent[i] - start[i]) / delta[i];
+        float t2 = (extent[i] - start[i]) / delta[i];
+        if (t1 > t2)
+        {
+            std::swap(t1, t2);
+        }
+
+        tEnter = std::max(tEnter, t1);
+        tExit = std::min(tExit, t2);
+        if (tEnter > tExit)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// half-length of shape projections onto unit direction n
+inline float boxExtent(const math::Vec3* axes, const math::Vec3& half, const math::Vec3& n)
+{
+    return half.x * std::abs(n.dot(axes[0])) + half.y * std::abs(n.dot(axes[1])) + half.z * std::abs(n.dot(axes[2]));
+}
+
+inline float cylinderExtent(const math::Vec3& axis, float halfHeight, float radius, const math::Vec3& n)
+{
+    float c = n.dot(axis);
+    return halfHeight * std::abs(c) + radius * std::sqrt(std::max(0.0f, 1.0f - c * c));
+}
+
+inline float capsuleExtent(const math::Vec3& axis, float halfHeight, float radius, const math::Vec3& n)
+{
+    return halfHeight * std::abs(n.dot(axis)) + radius;
+}
+
+// minimum-overlap search over candidate separating axes for shapes without closed-form distance,
+// only axes offered are tested, so near rim/edge contacts may be reported slightly early
+class SeparatingAxes {
+public:
+    explicit SeparatingAxes(const math::Vec3& offset) : m_offset(offset) {}
+
+    // axis need not be unit, degenerate axes are skipped; extents are callables of unit axis
+    template <typename ExtentA, typename ExtentB>
+    bool test(math::Vec3 axis, ExtentA extentA, ExtentB extentB)
+    {
+        float lengthSq = axis.dot(axis);
+        if (lengthSq < GEOMETRY_EPSILON)
+        {
+            return true;
+        }
+
+        axis = axis / std::sqrt(lengthSq);
+        float dist = m_offset.dot(axis);
+        float overlap = extentA(axis) + extentB(axis) - std::abs(dist);
+
+        if (overlap < 0.0f)
+        {
+            return false;
+        }
+
+        if (overlap < m_minOverlap)
+        {
+            m_minOverlap = overlap;
+            m_normal = dist < 0.0f ? axis * -1.0f : axis;
+        }
+        return true;
+    }
+
+    void write(CollisionInfo& outInfo) const
+    {
+        outInfo.penetration = m_minOverlap;
+        outInfo.normal = m_normal;
+    }
+
+private:
+    math::Vec3 m_offset;    // from first shape to second
+    float m_minOverlap = std::numeric_limits<float>::infinity();
+    math::Vec3 m_normal{0.0f, 1.0f, 0.0f};
+};
+
+} // namespace geometry
+} // namespace collision
+} // namespace BulletPhysics
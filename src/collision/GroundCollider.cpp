@@ -19,30 +19,44 @@ void GroundCollider::setGroundY(float level)
     m_position.y = level;
 }
 
-bool GroundCollider::testCollision(const Collider& other, CollisionInfo& outInfo) const
+bool GroundCollider::testPoint(const math::Vec3& point) const
 {
-    switch (other.getShape()) {
-        case CollisionShape::Box: {
-            return testCollisionWithBox(dynamic_cast<const BoxCollider&>(other), outInfo);
-        }
-        case CollisionShape::Ground: {
-            // two ground planes don't collide
-            return false;
-        }
-        default:
-            return false;
-    }
+    return point.y <= m_position.y;
 }
 
-bool GroundCollider::testPoint(const math::Vec3& point) const
+bool GroundCollider::testSegment(const math::Vec3& start, const math::Vec3& end, SweepInfo& outInfo) const
 {
-    return point.y <= m_position.y;
+    const float groundY = m_position.y;
+
+    // start already below ground
+    if (start.y <= groundY)
+    {
+        outInfo.time = 0.0f;
+        outInfo.point = start;
+        outInfo.normal = math::Vec3{0.0f, 1.0f, 0.0f};
+        return true;
+    }
+
+    if (end.y > groundY)
+    {
+        return false;
+    }
+
+    // plane crossing: t = (y0 - ground) / (y0 - y1)
+    float t = (start.y - groundY) / (start.y - end.y);
+
+    outInfo.time = t;
+    outInfo.point = start + (end - start) * t;
+    outInfo.point.y = groundY;
+    outInfo.normal = math::Vec3{0.0f, 1.0f, 0.0f};
+    return true;
 }
 
-bool GroundCollider::testCollisionWithBox(const BoxCollider& box, CollisionInfo& outInfo) const
+// sphere touches ground when its lowest point does
+bool GroundCollider::testSweptSphere(const math::Vec3& start, const math::Vec3& end, float radius, SweepInfo& outInfo) const
 {
-    // box will test collision with us
-    return false;
+    const math::Vec3 down{0.0f, radius, 0.0f};
+    return testSegment(start - down, end - down, outInfo);
 }
 
 } // namespace collision
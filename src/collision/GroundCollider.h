@@ -12,7 +12,8 @@ namespace collision {
 
 class BoxCollider;
 
-// represents an infinite ground plane (similar to WorldBoundaryShape2D in Godot)
+// represents an infinite ground plane (similar to WorldBoundaryShape2D in Godot),
+// level is in local frame and follows floating origin through setPosition (only y is used)
 class GroundCollider : public Collider {
 public:
     explicit GroundCollider(float groundY = 0.0f);
@@ -21,13 +22,14 @@ public:
     const math::Vec3& getPosition() const override { return m_position; }
     void setPosition(const math::Vec3& pos) override;
 
+    AABB getBounds() const override { return AABB::halfSpaceBelow(m_position.y); }
+
     float getGroundY() const { return m_position.y; }
     void setGroundY(float level);
 
-    bool testCollision(const Collider& other, CollisionInfo& outInfo) const override;
     bool testPoint(const math::Vec3& point) const override;
-
-    bool testCollisionWithBox(const BoxCollider& box, CollisionInfo& outInfo) const;
+    bool testSegment(const math::Vec3& start, const math::Vec3& end, SweepInfo& outInfo) const override;
+    bool testSweptSphere(const math::Vec3& start, const math::Vec3& end, float radius, SweepInfo& outInfo) const override;
 
 private:
     math::Vec3 m_position{};
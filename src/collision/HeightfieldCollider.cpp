@@ -0,0 +1,531 @@
+/*
+ * HeightfieldCollider.cpp
+ */
+
+#include "HeightfieldCollider.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define BULLET_PHYSICS_HAS_MMAP
+#endif
+
+namespace BulletPhysics {
+namespace collision {
+
+namespace {
+
+// Moller-Trumbore segment/triangle intersection, t in segment parameter units
+bool intersectTriangle(const math::Vec3& origin, const math::Vec3& delta, const math::Vec3& p0, const math::Vec3& p1, const math::Vec3& p2, float& outT)
+{
+    math::Vec3 edge1 = p1 - p0;
+    math::Vec3 edge2 = p2 - p0;
+
+    math::Vec3 p = delta.cross(edge2);
+    float det = edge1.dot(p);
+    if (std::abs(det) < 1e-12f)
+    {
+        return false;
+    }
+
+    float invDet = 1.0f / det;
+    math::Vec3 s = origin - p0;
+
+    float u = s.dot(p) * invDet;
+    if (u < 0.0f || u > 1.0f)
+    {
+        return false;
+    }
+
+    math::Vec3 q = s.cross(edge1);
+    float v = delta.dot(q) * invDet;
+    if (v < 0.0f || u + v > 1.0f)
+    {
+        return false;
+    }
+
+    outT = edge2.dot(q) * invDet;
+    return true;
+}
+
+// clip segment parameter interval [t0, t1] to rectangle in xz plane
+bool clipToRect(const math::Vec3& start, const math::Vec3& delta, float minX, float maxX, float minZ, float maxZ, float& t0, float& t1)
+{
+    const float origin[2] = {start.x, start.z};
+    const float direction[2] = {delta.x, delta.z};
+    const float lower[2] = {minX, minZ};
+    const float upper[2] = {maxX, maxZ};
+
+    for (int axis = 0; axis < 2; axis++)
+    {
+        if (std::abs(direction[axis]) < 1e-12f)
+        {
+            if (origin[axis] < lower[axis] || origin[axis] > upper[axis])
+            {
+                return false;
+            }
+            continue;
+        }
+
+        float inv = 1.0f / direction[axis];
+        float tNear = (lower[axis] - origin[axis]) * inv;
+        float tFar = (upper[axis] - origin[axis]) * inv;
+        if (tNear > tFar)
+        {
+            std::swap(tNear, tFar);
+        }
+
+        t0 = std::max(t0, tNear);
+        t1 = std::min(t1, tFar);
+        if (t0 > t1)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace
+
+HeightfieldCollider::HeightfieldCollider(size_t width, size_t depth, float cellSize, std::vector<float> heights)
+{
+    setHeights(width, depth, cellSize, std::move(heights));
+}
+
+HeightfieldCollider::~HeightfieldCollider()
+{
+    releaseMapping();
+}
+
+void HeightfieldCollider::setHeights(size_t width, size_t depth, float cellSize, std::vector<float> heights)
+{
+    releaseMapping();
+
+    m_ownedHeights = std::move(heights);
+
+    // grid needs at least one cell
+    if (width < 2 || depth < 2 || m_ownedHeights.size() < width * depth)
+    {
+        m_ownedHeights.clear();
+        width = 0;
+        depth = 0;
+    }
+
+    m_width = width;
+    m_depth = depth;
+    m_cellSize = cellSize > 0.0f ? cellSize : 1.0f;
+    m_heights = m_ownedHeights.empty() ? nullptr : m_ownedHeights.data();
+
+    buildPyramid();
+}
+
+bool HeightfieldCollider::loadFromFile(const std::string& filename, size_t width, size_t depth, float cellSize)
+{
+    if (width < 2 || depth < 2)
+    {
+        return false;
+    }
+
+    const size_t bytes = width * depth * sizeof(float);
+
+#ifdef BULLET_PHYSICS_HAS_MMAP
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat info{};
+    if (::fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < bytes)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    void* mapping = ::mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+
+    if (mapping == MAP_FAILED)
+    {
+        return false;
+    }
+
+    setHeights(0, 0, cellSize, {});
+
+    m_mapping = mapping;
+    m_mappingSize = bytes;
+    m_heights = static_cast<const float*>(mapping);
+    m_width = width;
+    m_depth = depth;
+
+    buildPyramid();
+    return true;
+#else
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    std::vector<float> heights(width * depth);
+    if (!file.read(reinterpret_cast<char*>(heights.data()), static_cast<std::streamsize>(bytes)))
+    {
+        return false;
+    }
+
+    setHeights(width, depth, cellSize, std::move(heights));
+    return true;
+#endif
+}
+
+void HeightfieldCollider::releaseMapping()
+{
+#ifdef BULLET_PHYSICS_HAS_MMAP
+    if (m_mapping)
+    {
+        ::munmap(m_mapping, m_mappingSize);
+    }
+#endif
+    m_mapping = nullptr;
+    m_mappingSize = 0;
+}
+
+void HeightfieldCollider::buildPyramid()
+{
+    m_levels.clear();
+
+    if (!m_heights)
+    {
+        return;
+    }
+
+    // level 0: bounds of each cell's four corners
+    Level base{m_width - 1, m_depth - 1, {}, {}};
+    base.minHeights.resize(base.width * base.depth);
+    base.maxHeights.resize(base.width * base.depth);
+
+    for (size_t j = 0; j < base.depth; j++)
+    {
+        for (size_t i = 0; i < base.width; i++)
+        {
+            const float h[4] = {sample(i, j), sample(i + 1, j), sample(i, j + 1), sample(i + 1, j + 1)};
+            base.minHeights[j * base.width + i] = *std::min_element(h, h + 4);
+            base.maxHeights[j * base.width + i] = *std::max_element(h, h + 4);
+        }
+    }
+    m_levels.push_back(std::move(base));
+
+    // coarser levels until single root node
+    while (m_levels.back().width > 1 || m_levels.back().depth > 1)
+    {
+        const Level& fine = m_levels.back();
+        Level coarse{(fine.width + 1) / 2, (fine.depth + 1) / 2, {}, {}};
+        coarse.minHeights.assign(coarse.width * coarse.depth, std::numeric_limits<float>::infinity());
+        coarse.maxHeights.assign(coarse.width * coarse.depth, -std::numeric_limits<float>::infinity());
+
+        for (size_t j = 0; j < fine.depth; j++)
+        {
+            for (size_t i = 0; i < fine.width; i++)
+            {
+                size_t parent = (j / 2) * coarse.width + i / 2;
+                coarse.minHeights[parent] = std::min(coarse.minHeights[parent], fine.minHeights[j * fine.width + i]);
+                coarse.maxHeights[parent] = std::max(coarse.maxHeights[parent], fine.maxHeights[j * fine.width + i]);
+            }
+        }
+
+        m_levels.push_back(std::move(coarse));
+    }
+}
+
+AABB HeightfieldCollider::getBounds() const
+{
+    if (m_levels.empty())
+    {
+        return {m_position, m_position};
+    }
+
+    // terrain is solid below its surface, anything under lowest sample is still inside
+    const Level& root = m_levels.back();
+    return {
+        {m_position.x, -std::numeric_limits<float>::infinity(), m_position.z},
+        {m_position.x + (m_width - 1) * m_cellSize, m_position.y + root.maxHeights[0], m_position.z + (m_depth - 1) * m_cellSize}
+    };
+}
+
+bool HeightfieldCollider::locate(float x, float z, size_t& outI, size_t& outJ, float& outU, float& outV) const
+{
+    if (!m_heights)
+    {
+        return false;
+    }
+
+    float gx = (x - m_position.x) / m_cellSize;
+    float gz = (z - m_position.z) / m_cellSize;
+
+    if (gx < 0.0f || gz < 0.0f || gx > static_cast<float>(m_width - 1) || gz > static_cast<float>(m_depth - 1))
+    {
+        return false;
+    }
+
+    // points on far edge belong to last cell
+    outI = std::min(static_cast<size_t>(gx), m_width - 2);
+    outJ = std::min(static_cast<size_t>(gz), m_depth - 2);
+    outU = gx - static_cast<float>(outI);
+    outV = gz - static_cast<float>(outJ);
+    return true;
+}
+
+bool HeightfieldCollider::getHeight(float x, float z, float& outHeight) const
+{
+    size_t i, j;
+    float u, v;
+    if (!locate(x, z, i, j, u, v))
+    {
+        return false;
+    }
+
+    const float h00 = sample(i, j);
+    const float h10 = sample(i + 1, j);
+    const float h01 = sample(i, j + 1);
+    const float h11 = sample(i + 1, j + 1);
+
+    // triangle (00, 10, 11) below diagonal, (00, 11, 01) above
+    float h = u >= v
+        ? h00 + u * (h10 - h00) + v * (h11 - h10)
+        : h00 + v * (h01 - h00) + u * (h11 - h01);
+
+    outHeight = m_position.y + h;
+    return true;
+}
+
+bool HeightfieldCollider::getNormal(float x, float z, math::Vec3& outNormal) const
+{
+    size_t i, j;
+    float u, v;
+    if (!locate(x, z, i, j, u, v))
+    {
+        return false;
+    }
+
+    const float h00 = sample(i, j);
+    const float h10 = sample(i + 1, j);
+    const float h01 = sample(i, j + 1);
+    const float h11 = sample(i + 1, j + 1);
+
+    // surface gradient of containing triangle
+    float dhdx = u >= v ? h10 - h00 : h11 - h01;
+    float dhdz = u >= v ? h11 - h10 : h01 - h00;
+
+    outNormal = math::Vec3{-dhdx / m_cellSize, 1.0f, -dhdz / m_cellSize}.normalized();
+    return true;
+}
+
+bool HeightfieldCollider::getSphereContact(const math::Vec3& center, float radius, CollisionInfo& outInfo) const
+{
+    float height;
+    math::Vec3 normal;
+    if (!getHeight(center.x, center.z, height) || !getNormal(center.x, center.z, normal))
+    {
+        return false;
+    }
+
+    // vertical gap to surface projected on its normal
+    const float distance = (center.y - height) * normal.y;
+    if (distance >= radius)
+    {
+        return false;
+    }
+
+    outInfo.normal = normal;
+    outInfo.penetration = radius - distance;
+    return true;
+}
+
+bool HeightfieldCollider::testPoint(const math::Vec3& point) const
+{
+    float height;
+    return getHeight(point.x, point.z, height) && point.y <= height;
+}
+
+bool HeightfieldCollider::testSegment(const math::Vec3& start, const math::Vec3& end, SweepInfo& outInfo) const
+{
+    if (m_levels.empty())
+    {
+        return false;
+    }
+
+    math::Vec3 delta = end - start;
+
+    // start already under terrain
+    float height;
+    if (getHeight(start.x, start.z, height) && start.y <= height)
+    {
+        outInfo.time = 0.0f;
+        outInfo.point = start;
+        getNormal(start.x, start.z, outInfo.normal);
+        return true;
+    }
+
+    // entering grid through its side below surface hits terrain wall
+    const float maxX = m_position.x + static_cast<float>(m_width - 1) * m_cellSize;
+    const float maxZ = m_position.z + static_cast<float>(m_depth - 1) * m_cellSize;
+
+    float t0 = 0.0f;
+    float t1 = 1.0f;
+    if (!clipToRect(start, delta, m_position.x, maxX, m_position.z, maxZ, t0, t1))
+    {
+        return false;
+    }
+
+    if (t0 > 0.0f)
+    {
+        math::Vec3 entry = start + delta * t0;
+        if (getHeight(entry.x, entry.z, height) && entry.y <= height)
+        {
+            outInfo.time = t0;
+            outInfo.point = entry;
+            // outward normal of side face the segment crossed
+            const float distances[4] = {
+                std::abs(entry.x - m_position.x), std::abs(entry.x - maxX),
+                std::abs(entry.z - m_position.z), std::abs(entry.z - maxZ)
+            };
+            const math::Vec3 normals[4] = {{-1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, -1.0f}, {0.0f, 0.0f, 1.0f}};
+            outInfo.normal = normals[std::min_element(distances, distances + 4) - distances];
+            return true;
+        }
+    }
+
+    return marchNode(m_levels.size() - 1, 0, 0, start, delta, 0.0f, 1.0f, outInfo);
+}
+
+// lowest point of sphere against terrain, on slopes sphere side touches first so hit is reported slightly late
+bool HeightfieldCollider::testSweptSphere(const math::Vec3& start, const math::Vec3& end, float radius, SweepInfo& outInfo) const
+{
+    const math::Vec3 down{0.0f, radius, 0.0f};
+    return testSegment(start - down, end - down, outInfo);
+}
+
+// front-to-back descent of min/max pyramid, first leaf hit is earliest along segment
+bool HeightfieldCollider::marchNode(size_t level, size_t i, size_t j, const math::Vec3& start, const math::Vec3& delta, float t0, float t1, SweepInfo& outInfo) const
+{
+    const Level& node = m_levels[level];
+    const size_t span = size_t{1} << level;     // cells per node side
+
+    const float minX = m_position.x + static_cast<float>(i * span) * m_cellSize;
+    const float minZ = m_position.z + static_cast<float>(j * span) * m_cellSize;
+    const float maxX = m_position.x + static_cast<float>(std::min((i + 1) * span, m_width - 1)) * m_cellSize;
+    const float maxZ = m_position.z + static_cast<float>(std::min((j + 1) * span, m_depth - 1)) * m_cellSize;
+
+    if (!clipToRect(start, delta, minX, maxX, minZ, maxZ, t0, t1))
+    {
+        return false;
+    }
+
+    // segment passes above everything in node
+    const float lowestY = std::min(start.y + delta.y * t0, start.y + delta.y * t1);
+    if (lowestY > m_position.y + node.maxHeights[j * node.width + i])
+    {
+        return false;
+    }
+
+    if (level == 0)
+    {
+        return intersectCell(i, j, start, delta, t0, t1, outInfo);
+    }
+
+    // visit children in order of entry along segment
+    const Level& child = m_levels[level - 1];
+    const size_t childSpan = span / 2;
+
+    struct Entry {
+        size_t i, j;
+        float t;
+    };
+    std::array<Entry, 4> entries;
+    size_t count = 0;
+
+    for (size_t cj = 2 * j; cj < std::min(2 * j + 2, child.depth); cj++)
+    {
+        for (size_t ci = 2 * i; ci < std::min(2 * i + 2, child.width); ci++)
+        {
+            float c0 = t0;
+            float c1 = t1;
+            const float cMinX = m_position.x + static_cast<float>(ci * childSpan) * m_cellSize;
+            const float cMinZ = m_position.z + static_cast<float>(cj * childSpan) * m_cellSize;
+            const float cMaxX = m_position.x + static_cast<float>(std::min((ci + 1) * childSpan, m_width - 1)) * m_cellSize;
+            const float cMaxZ = m_position.z + static_cast<float>(std::min((cj + 1) * childSpan, m_depth - 1)) * m_cellSize;
+
+            // insertion keeps entries sorted by t, at most 4 children
+            if (clipToRect(start, delta, cMinX, cMaxX, cMinZ, cMaxZ, c0, c1) && count < entries.size())
+            {
+                size_t k = count++;
+                for (; k > 0 && entries[k - 1].t > c0; k--)
+                {
+                    entries[k] = entries[k - 1];
+                }
+                entries[k] = {ci, cj, c0};
+            }
+        }
+    }
+
+    for (size_t k = 0; k < count; k++)
+    {
+        if (marchNode(level - 1, entries[k].i, entries[k].j, start, delta, t0, t1, outInfo))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool HeightfieldCollider::intersectCell(size_t i, size_t j, const math::Vec3& start, const math::Vec3& delta, float t0, float t1, SweepInfo& outInfo) const
+{
+    const float x0 = m_position.x + static_cast<float>(i) * m_cellSize;
+    const float z0 = m_position.z + static_cast<float>(j) * m_cellSize;
+    const float x1 = x0 + m_cellSize;
+    const float z1 = z0 + m_cellSize;
+
+    const math::Vec3 p00{x0, m_position.y + sample(i, j), z0};
+    const math::Vec3 p10{x1, m_position.y + sample(i + 1, j), z0};
+    const math::Vec3 p01{x0, m_position.y + sample(i, j + 1), z1};
+    const math::Vec3 p11{x1, m_position.y + sample(i + 1, j + 1), z1};
+
+    // tolerance so hits on shared cell edges are not lost
+    constexpr float tolerance = 1e-5f;
+
+    float best = std::numeric_limits<float>::infinity();
+    float t;
+
+    if (intersectTriangle(start, delta, p00, p10, p11, t) && t >= t0 - tolerance && t <= t1 + tolerance)
+    {
+        best = t;
+    }
+    if (intersectTriangle(start, delta, p00, p11, p01, t) && t >= t0 - tolerance && t <= t1 + tolerance)
+    {
+        best = std::min(best, t);
+    }
+
+    if (best > 1.0f || best < 0.0f)
+    {
+        return false;
+    }
+
+    outInfo.time = best;
+    outInfo.point = start + delta * best;
+    getNormal(outInfo.point.x, outInfo.point.z, outInfo.normal);
+    return true;
+}
+
+} // namespace collision
+} // namespace BulletPhysics
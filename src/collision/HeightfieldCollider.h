@@ -0,0 +1,92 @@
+/*
+ * HeightfieldCollider.h
+ */
+
+#pragma once
+
+#include "Collider.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace BulletPhysics {
+namespace collision {
+
+// terrain from regular elevation grid (DEM), each cell split into two triangles along (x0, z0)-(x1, z1) diagonal;
+// min/max pyramid over cells lets segment queries skip whole regions the segment passes above
+class HeightfieldCollider : public Collider {
+public:
+    HeightfieldCollider() = default;
+    HeightfieldCollider(size_t width, size_t depth, float cellSize, std::vector<float> heights);
+    ~HeightfieldCollider() override;
+
+    HeightfieldCollider(const HeightfieldCollider&) = delete;
+    HeightfieldCollider& operator=(const HeightfieldCollider&) = delete;
+
+    // grid of width x depth samples (row-major, x fastest), heights in meters
+    void setHeights(size_t width, size_t depth, float cellSize, std::vector<float> heights);
+
+    // raw little-endian float32 DEM, memory-mapped where supported
+    bool loadFromFile(const std::string& filename, size_t width, size_t depth, float cellSize);
+
+    CollisionShape getShape() const override { return CollisionShape::Heightfield; }
+
+    // grid origin: sample (0, 0) lies at (x, z), all heights are offset by y
+    const math::Vec3& getPosition() const override { return m_position; }
+    void setPosition(const math::Vec3& pos) override { m_position = pos; }
+
+    AABB getBounds() const override;
+
+    bool testPoint(const math::Vec3& point) const override;
+    bool testSegment(const math::Vec3& start, const math::Vec3& end, SweepInfo& outInfo) const override;
+    bool testSweptSphere(const math::Vec3& start, const math::Vec3& end, float radius, SweepInfo& outInfo) const override;
+
+    // terrain queries (false outside grid)
+    bool getHeight(float x, float z, float& outHeight) const;
+    bool getNormal(float x, float z, math::Vec3& outNormal) const;
+
+    // sphere against plane of triangle under its center, exact on flat facets (radius 0 tests single point)
+    bool getSphereContact(const math::Vec3& center, float radius, CollisionInfo& outInfo) const;
+
+    size_t getWidth() const { return m_width; }
+    size_t getDepth() const { return m_depth; }
+    float getCellSize() const { return m_cellSize; }
+    bool isMemoryMapped() const { return m_mapping != nullptr; }
+
+private:
+    math::Vec3 m_position{};
+
+    size_t m_width = 0;
+    size_t m_depth = 0;
+    float m_cellSize = 1.0f;
+
+    // heights point either into owned storage or into file mapping
+    const float* m_heights = nullptr;
+    std::vector<float> m_ownedHeights;
+    void* m_mapping = nullptr;
+    size_t m_mappingSize = 0;
+
+    // min/max pyramid, level 0 holds one node per cell, each next level halves both dimensions
+    struct Level {
+        size_t width;
+        size_t depth;
+        std::vector<float> minHeights;
+        std::vector<float> maxHeights;
+    };
+    std::vector<Level> m_levels;
+
+    float sample(size_t i, size_t j) const { return m_heights[j * m_width + i]; }
+
+    void releaseMapping();
+    void buildPyramid();
+
+    // locate cell and local coordinates (0-1) of world point
+    bool locate(float x, float z, size_t& outI, size_t& outJ, float& outU, float& outV) const;
+
+    bool marchNode(size_t level, size_t i, size_t j, const math::Vec3& start, const math::Vec3& delta, float t0, float t1, SweepInfo& outInfo) const;
+    bool intersectCell(size_t i, size_t j, const math::Vec3& start, const math::Vec3& delta, float t0, float t1, SweepInfo& outInfo) const;
+};
+
+} // namespace collision
+} // namespace BulletPhysics
@@ -0,0 +1,35 @@
+/*
+ * Material.h
+ */
+
+#pragma once
+
+#include <limits>
+
+namespace BulletPhysics {
+namespace collision {
+
+// terminal ballistics properties of collider surface, consumed by projectile impact response
+struct Material {
+    float density = 0.0f;           // kg/m^3, inertial (velocity squared) resistance term, 0 disables it
+    float resistance = 1.0e9f;      // Pa, quasi-static penetration resistance (R in Poncelet equation)
+    float thickness = std::numeric_limits<float>::infinity();     // m, finite for plates that can be perforated
+
+    float ricochetAngle = 0.2f;     // rad, critical grazing angle, shallower impacts ricochet
+    float restitution = 0.3f;       // normal restitution at fully grazing impact, falls to 0 at ricochetAngle
+    float friction = 0.2f;          // Coulomb coefficient, tangential impulse limited by friction * normal impulse
+};
+
+// common targets, rough values for small arms projectiles
+namespace materials {
+
+inline constexpr Material STEEL{7850.0f, 1.6e9f, std::numeric_limits<float>::infinity(), 0.35f, 0.4f, 0.1f};
+inline constexpr Material CONCRETE{2400.0f, 1.5e8f, std::numeric_limits<float>::infinity(), 0.25f, 0.2f, 0.4f};
+inline constexpr Material WOOD{600.0f, 2.0e7f, std::numeric_limits<float>::infinity(), 0.15f, 0.15f, 0.5f};
+inline constexpr Material SOIL{1600.0f, 4.0e6f, std::numeric_limits<float>::infinity(), 0.12f, 0.1f, 0.6f};
+inline constexpr Material WATER{1000.0f, 1.0e5f, std::numeric_limits<float>::infinity(), 0.12f, 0.5f, 0.0f};
+
+} // namespace materials
+
+} // namespace collision
+} // namespace BulletPhysics
@@ -0,0 +1,76 @@
+/*
+ * Narrowphase.cpp
+ */
+
+#include "Narrowphase.h"
+
+#include "BoxCollider.h"
+#include "CapsuleCollider.h"
+#include "CylinderCollider.h"
+#include "GroundCollider.h"
+#include "HeightfieldCollider.h"
+#include "SphereCollider.h"
+
+namespace BulletPhysics {
+namespace collision {
+
+namespace {
+
+// adapts typed member test to table signature, shapes are checked by table slot so static_cast is safe
+template <typename A, typename B, bool (A::*Test)(const B&, CollisionInfo&) const>
+bool dispatch(const Collider& a, const Collider& b, CollisionInfo& outInfo)
+{
+    return (static_cast<const A&>(a).*Test)(static_cast<const B&>(b), outInfo);
+}
+
+template <typename Table>
+constexpr void registerPair(Table& table, CollisionShape shapeA, CollisionShape shapeB, NarrowphaseFn test)
+{
+    const size_t a = static_cast<size_t>(shapeA);
+    const size_t b = static_cast<size_t>(shapeB);
+
+    table[a][b] = {test, false};
+    if (a != b)
+    {
+        table[b][a] = {test, true};
+    }
+}
+
+template <typename Table>
+constexpr Table buildTable()
+{
+    Table table{};
+
+    registerPair(table, CollisionShape::Box, CollisionShape::Box, &dispatch<BoxCollider, BoxCollider, &BoxCollider::testCollisionWithBox>);
+    registerPair(table, CollisionShape::Box, CollisionShape::Ground, &dispatch<BoxCollider, GroundCollider, &BoxCollider::testCollisionWithGround>);
+    registerPair(table, CollisionShape::Box, CollisionShape::Heightfield, &dispatch<BoxCollider, HeightfieldCollider, &BoxCollider::testCollisionWithHeightfield>);
+
+    registerPair(table, CollisionShape::Sphere, CollisionShape::Sphere, &dispatch<SphereCollider, SphereCollider, &SphereCollider::testCollisionWithSphere>);
+    registerPair(table, CollisionShape::Sphere, CollisionShape::Capsule, &dispatch<SphereCollider, CapsuleCollider, &SphereCollider::testCollisionWithCapsule>);
+    registerPair(table, CollisionShape::Sphere, CollisionShape::Cylinder, &dispatch<SphereCollider, CylinderCollider, &SphereCollider::testCollisionWithCylinder>);
+    registerPair(table, CollisionShape::Sphere, CollisionShape::Box, &dispatch<SphereCollider, BoxCollider, &SphereCollider::testCollisionWithBox>);
+    registerPair(table, CollisionShape::Sphere, CollisionShape::Ground, &dispatch<SphereCollider, GroundCollider, &SphereCollider::testCollisionWithGround>);
+    registerPair(table, CollisionShape::Sphere, CollisionShape::Heightfield, &dispatch<SphereCollider, HeightfieldCollider, &SphereCollider::testCollisionWithHeightfield>);
+
+    registerPair(table, CollisionShape::Capsule, CollisionShape::Capsule, &dispatch<CapsuleCollider, CapsuleCollider, &CapsuleCollider::testCollisionWithCapsule>);
+    registerPair(table, CollisionShape::Capsule, CollisionShape::Cylinder, &dispatch<CapsuleCollider, CylinderCollider, &CapsuleCollider::testCollisionWithCylinder>);
+    registerPair(table, CollisionShape::Capsule, CollisionShape::Box, &dispatch<CapsuleCollider, BoxCollider, &CapsuleCollider::testCollisionWithBox>);
+    registerPair(table, CollisionShape::Capsule, CollisionShape::Ground, &dispatch<CapsuleCollider, GroundCollider, &CapsuleCollider::testCollisionWithGround>);
+    registerPair(table, CollisionShape::Capsule, CollisionShape::Heightfield, &dispatch<CapsuleCollider, HeightfieldCollider, &CapsuleCollider::testCollisionWithHeightfield>);
+
+    registerPair(table, CollisionShape::Cylinder, CollisionShape::Cylinder, &dispatch<CylinderCollider, CylinderCollider, &CylinderCollider::testCollisionWithCylinder>);
+    registerPair(table, CollisionShape::Cylinder, CollisionShape::Box, &dispatch<CylinderCollider, BoxCollider, &CylinderCollider::testCollisionWithBox>);
+    registerPair(table, CollisionShape::Cylinder, CollisionShape::Ground, &dispatch<CylinderCollider, GroundCollider, &CylinderCollider::testCollisionWithGround>);
+    registerPair(table, CollisionShape::Cylinder, CollisionShape::Heightfield, &dispatch<CylinderCollider, HeightfieldCollider, &CylinderCollider::testCollisionWithHeightfield>);
+
+    // ground and heightfield are static terrain, they never collide with each other
+
+    return table;
+}
+
+} // namespace
+
+constinit const Narrowphase::Table Narrowphase::s_table = buildTable<Narrowphase::Table>();
+
+} // namespace collision
+} // namespace BulletPhysics
@@ -0,0 +1,39 @@
+/*
+ * Narrowphase.h
+ */
+
+#pragma once
+
+#include "Collider.h"
+
+#include <array>
+#include <cstddef>
+
+namespace BulletPhysics {
+namespace collision {
+
+// pair test of two colliders whose shapes are known from table slot
+using NarrowphaseFn = bool (*)(const Collider& a, const Collider& b, CollisionInfo& outInfo);
+
+struct NarrowphaseEntry {
+    NarrowphaseFn test = nullptr;   // null when shapes never collide
+    bool swapped = false;           // test is registered for (b, a), call it with arguments exchanged
+};
+
+// static (shapeA, shapeB) dispatch table, each unordered shape pair is registered once
+// and its mirrored slot points to same test with swapped flag
+class Narrowphase {
+public:
+    static const NarrowphaseEntry& lookup(CollisionShape shapeA, CollisionShape shapeB)
+    {
+        return s_table[static_cast<size_t>(shapeA)][static_cast<size_t>(shapeB)];
+    }
+
+private:
+    using Table = std::array<std::array<NarrowphaseEntry, COLLISION_SHAPE_COUNT>, COLLISION_SHAPE_COUNT>;
+
+    static const Table s_table;
+};
+
+} // namespace collision
+} // namespace BulletPhysics
@@ -0,0 +1,247 @@
+/*
+ * OBBBatch.cpp
+ */
+
+#include "OBBBatch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace BulletPhysics {
+namespace collision {
+
+void OBBBatch::clear()
+{
+    for (auto& values : m_center) values.clear();
+    for (auto& values : m_axes) values.clear();
+    for (auto& values : m_half) values.clear();
+}
+
+void OBBBatch::reserve(size_t count)
+{
+    for (auto& values : m_center) values.reserve(count);
+    for (auto& values : m_axes) values.reserve(count);
+    for (auto& values : m_half) values.reserve(count);
+}
+
+void OBBBatch::add(const BoxCollider& box)
+{
+    for (auto& values : m_center) values.push_back(0.0f);
+    for (auto& values : m_axes) values.push_back(0.0f);
+    for (auto& values : m_half) values.push_back(0.0f);
+
+    set(size() - 1, box);
+}
+
+void OBBBatch::set(size_t index, const BoxCollider& box)
+{
+    const math::Vec3& position = box.getPosition();
+    const math::Vec3 half = box.getSize() * 0.5f;
+    const math::Vec3* axes = box.getAxes();
+
+    m_center[0][index] = position.x;
+    m_center[1][index] = position.y;
+    m_center[2][index] = position.z;
+
+    for (int i = 0; i < 3; i++)
+    {
+        m_axes[i * 3 + 0][index] = axes[i].x;
+        m_axes[i * 3 + 1][index] = axes[i].y;
+        m_axes[i * 3 + 2][index] = axes[i].z;
+    }
+
+    m_half[0][index] = half.x;
+    m_half[1][index] = half.y;
+    m_half[2][index] = half.z;
+}
+
+// same axes and tie-breaking as BoxCollider::testCollisionWithBox, but evaluates all of them;
+// boxes are processed in blocks with one simple loop per axis, so every loop vectorizes
+size_t OBBBatch::testAgainst(const BoxCollider& box, std::vector<OBBBatchHit>& outHits)
+{
+    outHits.clear();
+
+    const size_t count = size();
+    m_depth.resize(count);
+    m_dist.resize(count);
+    m_axis.resize(count);
+    m_separated.resize(count);
+
+    const math::Vec3& position = box.getPosition();
+    const math::Vec3* A = box.getAxes();
+    const float a[3] = {box.getSize().x * 0.5f, box.getSize().y * 0.5f, box.getSize().z * 0.5f};
+
+    const float inf = std::numeric_limits<float>::infinity();
+
+    // block-local scratch, stays in L1
+    float R[9][BLOCK_SIZE];
+    float absR[9][BLOCK_SIZE];
+    float t[3][BLOCK_SIZE];
+    float score[BLOCK_SIZE];
+    float depth[BLOCK_SIZE];
+    float dist[BLOCK_SIZE];
+    uint32_t axis[BLOCK_SIZE];
+    uint32_t separated[BLOCK_SIZE];
+
+    for (size_t base = 0; base < count; base += BLOCK_SIZE)
+    {
+        const size_t n = std::min(BLOCK_SIZE, count - base);
+
+        const float* cx = m_center[0].data() + base;
+        const float* cy = m_center[1].data() + base;
+        const float* cz = m_center[2].data() + base;
+        const float* b[3] = {m_half[0].data() + base, m_half[1].data() + base, m_half[2].data() + base};
+
+        // rotation of batch boxes in query frame
+        for (int i = 0; i < 3; i++)
+        {
+            for (int j = 0; j < 3; j++)
+            {
+                const float* bx = m_axes[j * 3 + 0].data() + base;
+                const float* by = m_axes[j * 3 + 1].data() + base;
+                const float* bz = m_axes[j * 3 + 2].data() + base;
+                float* r = R[i * 3 + j];
+                float* absr = absR[i * 3 + j];
+
+                for (size_t k = 0; k < n; k++)
+                {
+                    r[k] = A[i].x * bx[k] + A[i].y * by[k] + A[i].z * bz[k];
+                    absr[k] = std::abs(r[k]) + BoxCollider::SAT_EPSILON;
+                }
+            }
+
+            // translation in query frame
+            for (size_t k = 0; k < n; k++)
+            {
+                t[i][k] = (cx[k] - position.x) * A[i].x + (cy[k] - position.y) * A[i].y + (cz[k] - position.z) * A[i].z;
+            }
+        }
+
+        for (size_t k = 0; k < n; k++)
+        {
+            score[k] = inf;
+            depth[k] = 0.0f;
+            dist[k] = 0.0f;
+            axis[k] = 0;
+            separated[k] = 0;
+        }
+
+        // keep candidate if it beats current best, blended with 0/1 weights instead of
+        // selects since gcc refuses to if-convert several conditional stores sharing one condition
+        auto consider = [&](size_t k, float overlap, float candidateScore, float candidateDist, uint32_t id)
+        {
+            separated[k] |= static_cast<uint32_t>(overlap < 0.0f);
+
+            const float current = score[k];
+            const float weight = candidateScore < current ? 1.0f : 0.0f;
+            const uint32_t weightId = candidateScore < current ? 1u : 0u;
+
+            score[k] = std::min(current, candidateScore);
+            depth[k] += weight * (overlap - depth[k]);
+            dist[k] += weight * (candidateDist - dist[k]);
+            axis[k] += weightId * (id - axis[k]);
+        };
+
+        // face axes 0-2 (query box)
+        for (int i = 0; i < 3; i++)
+        {
+            const float* r0 = absR[i * 3 + 0];
+            const float* r1 = absR[i * 3 + 1];
+            const float* r2 = absR[i * 3 + 2];
+            const float* ti = t[i];
+
+            for (size_t k = 0; k < n; k++)
+            {
+                float overlap = a[i] + b[0][k] * r0[k] + b[1][k] * r1[k] + b[2][k] * r2[k] - std::abs(ti[k]);
+                consider(k, overlap, overlap, ti[k], static_cast<uint32_t>(i));
+            }
+        }
+
+        // face axes 3-5 (batch box)
+        for (int j = 0; j < 3; j++)
+        {
+            const float* bj = b[j];
+
+            for (size_t k = 0; k < n; k++)
+            {
+                float projection = t[0][k] * R[j][k] + t[1][k] * R[3 + j][k] + t[2][k] * R[6 + j][k];
+                float ra = a[0] * absR[j][k] + a[1] * absR[3 + j][k] + a[2] * absR[6 + j][k];
+                float overlap = ra + bj[k] - std::abs(projection);
+                consider(k, overlap, overlap, projection, static_cast<uint32_t>(3 + j));
+            }
+        }
+
+        // edge axes 6-14, scored with face bias so ties stay on faces
+        for (int i = 0; i < 3; i++)
+        {
+            const int i1 = (i + 1) % 3;
+            const int i2 = (i + 2) % 3;
+
+            for (int j = 0; j < 3; j++)
+            {
+                const int j1 = (j + 1) % 3;
+                const int j2 = (j + 2) % 3;
+                const uint32_t id = static_cast<uint32_t>(6 + i * 3 + j);
+
+                for (size_t k = 0; k < n; k++)
+                {
+                    float radius = a[i1] * absR[i2 * 3 + j][k] + a[i2] * absR[i1 * 3 + j][k]
+                                 + b[j1][k] * absR[i * 3 + j2][k] + b[j2][k] * absR[i * 3 + j1][k];
+                    float projection = t[i2][k] * R[i1 * 3 + j][k] - t[i1][k] * R[i2 * 3 + j][k];
+
+                    float length = std::sqrt(std::max(0.0f, 1.0f - R[i * 3 + j][k] * R[i * 3 + j][k]));
+                    float clampedLength = std::max(length, BoxCollider::SAT_PARALLEL_LIMIT);
+                    float overlap = (radius - std::abs(projection)) / clampedLength;
+
+                    // degenerate (parallel) edge axes never win, penalty is arithmetic to keep loop branch-free
+                    float penalty = (clampedLength - length) * 1e30f;
+                    float edgeScore = overlap / BoxCollider::SAT_EDGE_BIAS + penalty;
+
+                    consider(k, overlap, edgeScore, projection, id);
+                }
+            }
+        }
+
+        std::copy(depth, depth + n, m_depth.begin() + base);
+        std::copy(dist, dist + n, m_dist.begin() + base);
+        std::copy(axis, axis + n, m_axis.begin() + base);
+        std::copy(separated, separated + n, m_separated.begin() + base);
+    }
+
+    // compact hits and build normals
+    for (size_t k = 0; k < count; k++)
+    {
+        if (m_separated[k])
+        {
+            continue;
+        }
+
+        const uint32_t axis = m_axis[k];
+        math::Vec3 normal;
+
+        if (axis < 3)
+        {
+            normal = A[axis];
+        }
+        else if (axis < 6)
+        {
+            const int j = axis - 3;
+            normal = {m_axes[j * 3 + 0][k], m_axes[j * 3 + 1][k], m_axes[j * 3 + 2][k]};
+        }
+        else
+        {
+            const int i = (axis - 6) / 3;
+            const int j = (axis - 6) % 3;
+            math::Vec3 Bj{m_axes[j * 3 + 0][k], m_axes[j * 3 + 1][k], m_axes[j * 3 + 2][k]};
+            normal = A[i].cross(Bj).normalized();
+        }
+
+        outHits.push_back({static_cast<uint32_t>(k), {m_depth[k], m_dist[k] < 0.0f ? normal * -1.0f : normal}});
+    }
+
+    return outHits.size();
+}
+
+} // namespace collision
+} // namespace BulletPhysics
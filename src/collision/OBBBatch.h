@@ -0,0 +1,52 @@
+/*
+ * OBBBatch.h
+ */
+
+#pragma once
+
+#include "BoxCollider.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace BulletPhysics {
+namespace collision {
+
+struct OBBBatchHit {
+    uint32_t index;         // position of box in batch
+    CollisionInfo info;     // normal points from query box towards batch box
+};
+
+// structure-of-arrays copy of many OBBs for testing one box against all of them,
+// per-box SAT runs without branches so the compiler can vectorize the loop
+class OBBBatch {
+public:
+    void clear();
+    void reserve(size_t count);
+
+    // copy current state of box (call again after box moves)
+    void add(const BoxCollider& box);
+    void set(size_t index, const BoxCollider& box);
+
+    size_t size() const { return m_half[0].size(); }
+
+    // full 15-axis SAT of box against every stored box
+    size_t testAgainst(const BoxCollider& box, std::vector<OBBBatchHit>& outHits);
+
+private:
+    static constexpr size_t BLOCK_SIZE = 64;
+
+    std::array<std::vector<float>, 3> m_center;
+    std::array<std::vector<float>, 9> m_axes;    // axis i, component c at [i * 3 + c]
+    std::array<std::vector<float>, 3> m_half;
+
+    // per-box results of branchless pass
+    std::vector<float> m_depth;
+    std::vector<float> m_dist;      // signed center distance along chosen axis
+    std::vector<uint32_t> m_axis;
+    std::vector<uint32_t> m_separated;
+};
+
+} // namespace collision
+} // namespace BulletPhysics
@@ -0,0 +1,325 @@
+/*
+ * SpatialHashGrid.cpp
+ */
+
+#include "SpatialHashGrid.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace BulletPhysics {
+namespace collision {
+
+namespace {
+
+constexpr uint32_t MIN_BUCKETS = 64;
+constexpr uint64_t CELL_MASK = (1u << 21) - 1;     // 21 bits per packed cell coordinate
+
+// carve count elements of T from arena at offset, callers keep 8-byte types first so alignment holds
+template <typename T>
+T* carve(std::byte* arena, size_t& offset, size_t count)
+{
+    T* data = reinterpret_cast<T*>(arena + offset);
+    offset += count * sizeof(T);
+    return data;
+}
+
+} // namespace
+
+SpatialHashGrid::SpatialHashGrid(float cellSize)
+{
+    setCellSize(cellSize);
+}
+
+void SpatialHashGrid::setCellSize(float size)
+{
+    m_cellSize = size > 0.0f ? size : 1.0f;
+    m_inverseCellSize = 1.0f / m_cellSize;
+}
+
+int32_t SpatialHashGrid::cellCoord(float value) const
+{
+    // clamped so far-away items do not overflow cast
+    return static_cast<int32_t>(std::floor(std::clamp(value * m_inverseCellSize, -1.0e9f, 1.0e9f)));
+}
+
+uint64_t SpatialHashGrid::packCell(int32_t x, int32_t y, int32_t z)
+{
+    return ((static_cast<uint64_t>(x) & CELL_MASK) << 42) | ((static_cast<uint64_t>(y) & CELL_MASK) << 21) | (static_cast<uint64_t>(z) & CELL_MASK);
+}
+
+uint32_t SpatialHashGrid::bucketOf(int32_t x, int32_t y, int32_t z) const
+{
+    // Teschner et al. primes, then Fibonacci hashing for top bits
+    const uint32_t hash = (static_cast<uint32_t>(x) * 73856093u) ^ (static_cast<uint32_t>(y) * 19349663u) ^ (static_cast<uint32_t>(z) * 83492791u);
+    return (hash * 2654435761u) >> m_bucketShift;
+}
+
+void SpatialHashGrid::rebuild(const float* x, const float* y, const float* z, const float* radii, size_t count)
+{
+    m_count = count;
+    m_bucketCount = std::max(MIN_BUCKETS, std::bit_ceil(static_cast<uint32_t>(2 * count)));
+    m_bucketShift = 32 - std::countr_zero(m_bucketCount);
+
+    // sorted cell keys and unsorted staging keys first (8-byte), then 4-byte arrays
+    const size_t required = 2 * count * sizeof(uint64_t) + (m_bucketCount + 1) * sizeof(uint32_t) + count * (4 * sizeof(float) + 2 * sizeof(uint32_t));
+    if (required > m_arenaSize)
+    {
+        // grow with headroom so slowly rising counts do not reallocate every frame
+        m_arenaSize = required + required / 2;
+        m_arena = std::make_unique<std::byte[]>(m_arenaSize);
+    }
+
+    size_t offset = 0;
+    std::byte* arena = m_arena.get();
+    m_cellKeys = carve<uint64_t>(arena, offset, count);
+    uint64_t* itemKeys = carve<uint64_t>(arena, offset, count);
+    m_bucketStart = carve<uint32_t>(arena, offset, m_bucketCount + 1);
+    m_x = carve<float>(arena, offset, count);
+    m_y = carve<float>(arena, offset, count);
+    m_z = carve<float>(arena, offset, count);
+    m_radii = carve<float>(arena, offset, count);
+    m_indices = carve<uint32_t>(arena, offset, count);
+    uint32_t* itemBuckets = carve<uint32_t>(arena, offset, count);
+
+    // counting sort by bucket: counts land in start[b + 1], prefix sum turns them into starts
+    std::memset(m_bucketStart, 0, (m_bucketCount + 1) * sizeof(uint32_t));
+    m_maxRadius = 0.0f;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const int32_t cx = cellCoord(x[i]);
+        const int32_t cy = cellCoord(y[i]);
+        const int32_t cz = cellCoord(z[i]);
+
+        itemKeys[i] = packCell(cx, cy, cz);
+        itemBuckets[i] = bucketOf(cx, cy, cz);
+        m_bucketStart[itemBuckets[i] + 1]++;
+
+        if (radii)
+        {
+            m_maxRadius = std::max(m_maxRadius, radii[i]);
+        }
+    }
+
+    for (uint32_t b = 0; b < m_bucketCount; b++)
+    {
+        m_bucketStart[b + 1] += m_bucketStart[b];
+    }
+
+    // scatter advances each start to its end, shifted back afterwards
+    for (size_t i = 0; i < count; i++)
+    {
+        const uint32_t slot = m_bucketStart[itemBuckets[i]]++;
+
+        m_cellKeys[slot] = itemKeys[i];
+        m_x[slot] = x[i];
+        m_y[slot] = y[i];
+        m_z[slot] = z[i];
+        m_radii[slot] = radii ? radii[i] : 0.0f;
+        m_indices[slot] = static_cast<uint32_t>(i);
+    }
+
+    for (uint32_t b = m_bucketCount; b > 0; b--)
+    {
+        m_bucketStart[b] = m_bucketStart[b - 1];
+    }
+    m_bucketStart[0] = 0;
+}
+
+void SpatialHashGrid::rebuild(const std::vector<Collider*>& colliders)
+{
+    m_stagingX.clear();
+    m_stagingY.clear();
+    m_stagingZ.clear();
+    m_stagingRadii.clear();
+    m_stagingIndices.clear();
+
+    for (size_t i = 0; i < colliders.size(); i++)
+    {
+        const AABB bounds = colliders[i]->getBounds();
+        const math::Vec3 half = (bounds.max - bounds.min) * 0.5f;
+        const float radius = half.length();
+        if (!std::isfinite(radius))
+        {
+            continue;
+        }
+
+        const math::Vec3 center = bounds.min + half;
+        m_stagingX.push_back(center.x);
+        m_stagingY.push_back(center.y);
+        m_stagingZ.push_back(center.z);
+        m_stagingRadii.push_back(radius);
+        m_stagingIndices.push_back(static_cast<uint32_t>(i));
+    }
+
+    rebuild(m_stagingX.data(), m_stagingY.data(), m_stagingZ.data(), m_stagingRadii.data(), m_stagingX.size());
+
+    // back to positions in collider vector
+    for (size_t i = 0; i < m_count; i++)
+    {
+        m_indices[i] = m_stagingIndices[m_indices[i]];
+    }
+}
+
+SpatialHashGrid::CellRange SpatialHashGrid::cellRange(const math::Vec3& min, const math::Vec3& max) const
+{
+    return {
+        {cellCoord(min.x - m_maxRadius), cellCoord(min.y - m_maxRadius), cellCoord(min.z - m_maxRadius)},
+        {cellCoord(max.x + m_maxRadius), cellCoord(max.y + m_maxRadius), cellCoord(max.z + m_maxRadius)}
+    };
+}
+
+template <typename Visit>
+void SpatialHashGrid::forEachInRange(const CellRange& range, Visit visit) const
+{
+    const double cells = (static_cast<double>(range.max[0]) - range.min[0] + 1.0)
+                       * (static_cast<double>(range.max[1]) - range.min[1] + 1.0)
+                       * (static_cast<double>(range.max[2]) - range.min[2] + 1.0);
+
+    // range covering more cells than there are buckets, plain scan is cheaper
+    if (cells > static_cast<double>(m_bucketCount))
+    {
+        for (uint32_t slot = 0; slot < m_count; slot++)
+        {
+            visit(slot);
+        }
+        return;
+    }
+
+    for (int32_t cx = range.min[0]; cx <= range.max[0]; cx++)
+    {
+        for (int32_t cy = range.min[1]; cy <= range.max[1]; cy++)
+        {
+            for (int32_t cz = range.min[2]; cz <= range.max[2]; cz++)
+            {
+                const uint64_t key = packCell(cx, cy, cz);
+                const uint32_t bucket = bucketOf(cx, cy, cz);
+
+                for (uint32_t slot = m_bucketStart[bucket]; slot < m_bucketStart[bucket + 1]; slot++)
+                {
+                    if (m_cellKeys[slot] == key)
+                    {
+                        visit(slot);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void SpatialHashGrid::queryRadius(const math::Vec3& center, float radius, std::vector<uint32_t>& outIndices) const
+{
+    const math::Vec3 extent{radius, radius, radius};
+
+    forEachInRange(cellRange(center - extent, center + extent), [&](uint32_t slot)
+    {
+        const float dx = m_x[slot] - center.x;
+        const float dy = m_y[slot] - center.y;
+        const float dz = m_z[slot] - center.z;
+        const float reach = radius + m_radii[slot];
+
+        if (dx * dx + dy * dy + dz * dz <= reach * reach)
+        {
+            outIndices.push_back(m_indices[slot]);
+        }
+    });
+}
+
+void SpatialHashGrid::queryBox(const AABB& bounds, std::vector<uint32_t>& outIndices) const
+{
+    forEachInRange(cellRange(bounds.min, bounds.max), [&](uint32_t slot)
+    {
+        // squared distance from item center to box
+        const float dx = std::max({bounds.min.x - m_x[slot], 0.0f, m_x[slot] - bounds.max.x});
+        const float dy = std::max({bounds.min.y - m_y[slot], 0.0f, m_y[slot] - bounds.max.y});
+        const float dz = std::max({bounds.min.z - m_z[slot], 0.0f, m_z[slot] - bounds.max.z});
+
+        if (dx * dx + dy * dy + dz * dz <= m_radii[slot] * m_radii[slot])
+        {
+            outIndices.push_back(m_indices[slot]);
+        }
+    });
+}
+
+bool SpatialHashGrid::nearest(const math::Vec3& point, float maxDistance, uint32_t& outIndex, float& outDistance) const
+{
+    float best = maxDistance;
+    uint32_t bestSlot = std::numeric_limits<uint32_t>::max();
+
+    auto consider = [&](uint32_t slot)
+    {
+        const float dx = m_x[slot] - point.x;
+        const float dy = m_y[slot] - point.y;
+        const float dz = m_z[slot] - point.z;
+        const float distance = std::max(0.0f, std::sqrt(dx * dx + dy * dy + dz * dz) - m_radii[slot]);
+
+        if (distance <= best)
+        {
+            best = distance;
+            bestSlot = slot;
+        }
+    };
+
+    const int32_t px = cellCoord(point.x);
+    const int32_t py = cellCoord(point.y);
+    const int32_t pz = cellCoord(point.z);
+
+    // shells of cells at growing Chebyshev distance, items past shell r are at least r cells away
+    // minus largest radius, which ends the search once best or maxDistance is closer
+    for (int32_t r = 0; m_count > 0; r++)
+    {
+        const float side = static_cast<float>(2 * r + 1);
+        if (side * side * side > static_cast<float>(m_bucketCount))
+        {
+            // shell grew past table, finish with plain scan
+            for (uint32_t slot = 0; slot < m_count; slot++)
+            {
+                consider(slot);
+            }
+            break;
+        }
+
+        for (int32_t cx = px - r; cx <= px + r; cx++)
+        {
+            for (int32_t cy = py - r; cy <= py + r; cy++)
+            {
+                const bool inner = std::abs(cx - px) < r && std::abs(cy - py) < r;
+                for (int32_t cz = pz - r; cz <= pz + r; cz += (inner && r > 0) ? 2 * r : 1)
+                {
+                    const uint64_t key = packCell(cx, cy, cz);
+                    const uint32_t bucket = bucketOf(cx, cy, cz);
+
+                    for (uint32_t slot = m_bucketStart[bucket]; slot < m_bucketStart[bucket + 1]; slot++)
+                    {
+                        if (m_cellKeys[slot] == key)
+                        {
+                            consider(slot);
+                        }
+                    }
+                }
+            }
+        }
+
+        const float reached = static_cast<float>(r) * m_cellSize - m_maxRadius;
+        if (reached >= best || reached > maxDistance)
+        {
+            break;
+        }
+    }
+
+    if (bestSlot == std::numeric_limits<uint32_t>::max())
+    {
+        return false;
+    }
+
+    outIndex = m_indices[bestSlot];
+    outDistance = best;
+    return true;
+}
+
+} // namespace collision
+} // namespace BulletPhysics
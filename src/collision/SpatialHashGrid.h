@@ -0,0 +1,93 @@
+/*
+ * SpatialHashGrid.h
+ */
+
+#pragma once
+
+#include "AABB.h"
+#include "Collider.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace BulletPhysics {
+namespace collision {
+
+// uniform grid over unbounded space, cells hashed into bucket table sized to item count;
+// meant for fragment clouds rebuilt every frame (bulk counting sort, no incremental updates),
+// items are spheres (center, radius), radius 0 for point fragments
+class SpatialHashGrid {
+public:
+    explicit SpatialHashGrid(float cellSize = 1.0f);
+
+    // cell edge, about fragment speed * dt so frame motion crosses at most one cell,
+    // takes effect on next rebuild
+    void setCellSize(float size);
+    float getCellSize() const { return m_cellSize; }
+
+    // rebuild from structure-of-arrays positions, radii may be null for points;
+    // storage comes from one arena kept between rebuilds, so steady item counts allocate nothing
+    void rebuild(const float* x, const float* y, const float* z, const float* radii, size_t count);
+
+    // rebuild from bounding spheres of colliders, unbounded ones (ground) are left out,
+    // item index is position in given vector
+    void rebuild(const std::vector<Collider*>& colliders);
+
+    size_t size() const { return m_count; }
+
+    // indices of items touching sphere or box, appended to output in no particular order
+    void queryRadius(const math::Vec3& center, float radius, std::vector<uint32_t>& outIndices) const;
+    void queryBox(const AABB& bounds, std::vector<uint32_t>& outIndices) const;
+
+    // item with closest surface within maxDistance (distance 0 when point is inside item)
+    bool nearest(const math::Vec3& point, float maxDistance, uint32_t& outIndex, float& outDistance) const;
+
+private:
+    struct CellRange {
+        int32_t min[3];
+        int32_t max[3];
+    };
+
+    float m_cellSize;
+    float m_inverseCellSize;
+
+    // arena, carved into arrays below on each rebuild
+    std::unique_ptr<std::byte[]> m_arena;
+    size_t m_arenaSize = 0;
+
+    size_t m_count = 0;
+    uint32_t m_bucketCount = 0;
+    int m_bucketShift = 26;         // hash keeps top bits, bucket count is power of two
+    float m_maxRadius = 0.0f;       // widens query cell ranges, items may spill out of their cell
+
+    // items sorted by bucket, bucket b holds [m_bucketStart[b], m_bucketStart[b + 1])
+    uint32_t* m_bucketStart = nullptr;
+    uint64_t* m_cellKeys = nullptr;     // packed cell of item, filters other cells sharing bucket
+    float* m_x = nullptr;
+    float* m_y = nullptr;
+    float* m_z = nullptr;
+    float* m_radii = nullptr;
+    uint32_t* m_indices = nullptr;      // original item index
+
+    // collider rebuild staging, reused
+    std::vector<float> m_stagingX;
+    std::vector<float> m_stagingY;
+    std::vector<float> m_stagingZ;
+    std::vector<float> m_stagingRadii;
+    std::vector<uint32_t> m_stagingIndices;
+
+    int32_t cellCoord(float value) const;
+    static uint64_t packCell(int32_t x, int32_t y, int32_t z);
+    uint32_t bucketOf(int32_t x, int32_t y, int32_t z) const;
+
+    CellRange cellRange(const math::Vec3& min, const math::Vec3& max) const;
+
+    // call visit(sortedIndex) for every item stored in cells of range
+    template <typename Visit>
+    void forEachInRange(const CellRange& range, Visit visit) const;
+};
+
+} // namespace collision
+} // namespace BulletPhysics
@@ -0,0 +1,175 @@
+/*
+ * SphereCollider.cpp
+ */
+
+#include "SphereCollider.h"
+
+#include "BoxCollider.h"
+#include "CapsuleCollider.h"
+#include "CylinderCollider.h"
+#include "Geometry.h"
+#include "GroundCollider.h"
+#include "HeightfieldCollider.h"
+
+namespace BulletPhysics {
+namespace collision {
+
+SphereCollider::SphereCollider(float radius) : m_radius(radius) {}
+
+AABB SphereCollider::getBounds() const
+{
+    math::Vec3 extent{m_radius, m_radius, m_radius};
+    return {m_position - extent, m_position + extent};
+}
+
+bool SphereCollider::testPoint(const math::Vec3& point) const
+{
+    math::Vec3 d = point - m_position;
+    return d.dot(d) <= m_radius * m_radius;
+}
+
+bool SphereCollider::testSegment(const math::Vec3& start, const math::Vec3& end, SweepInfo& outInfo) const
+{
+    return testSweptSphere(start, end, 0.0f, outInfo);
+}
+
+// swept sphere against sphere is segment against sphere of summed radius
+bool SphereCollider::testSweptSphere(const math::Vec3& start, const math::Vec3& end, float radius, SweepInfo& outInfo) const
+{
+    math::Vec3 delta = end - start;
+
+    float t;
+    if (!geometry::segmentSphere(start, delta, m_position, m_radius + radius, t))
+    {
+        return false;
+    }
+
+    math::Vec3 center = start + delta * t;
+
+    outInfo.time = t;
+    if (t == 0.0f)
+    {
+        outInfo.normal = delta.normalized() * -1.0f;
+        outInfo.point = start;
+        return true;
+    }
+
+    outInfo.normal = (center - m_position).normalized();
+    outInfo.point = m_position + outInfo.normal * m_radius;
+    return true;
+}
+
+bool SphereCollider::testCollisionWithSphere(const SphereCollider& sphere, CollisionInfo& outInfo) const
+{
+    return geometry::sphereContact(m_position, m_radius, sphere.m_position, sphere.m_radius, math::Vec3{0.0f, 1.0f, 0.0f}, outInfo);
+}
+
+bool SphereCollider::testCollisionWithCapsule(const CapsuleCollider& capsule, CollisionInfo& outInfo) const
+{
+    math::Vec3 a;
+    math::Vec3 b;
+    capsule.getSegment(a, b);
+
+    math::Vec3 closest = geometry::closestPointOnSegment(m_position, a, b);
+    return geometry::sphereContact(m_position, m_radius, closest, capsule.getRadius(), geometry::perpendicular(capsule.getAxis()), outInfo);
+}
+
+// closest point on cylinder from axial and radial coordinates of sphere center
+bool SphereCollider::testCollisionWithCylinder(const CylinderCollider& cylinder, CollisionInfo& outInfo) const
+{
+    const math::Vec3& axis = cylinder.getAxis();
+    const float halfHeight = cylinder.getHeight() * 0.5f;
+    const float radius = cylinder.getRadius();
+
+    math::Vec3 m = m_position - cylinder.getPosition();
+    float h = m.dot(axis);
+    math::Vec3 radial = m - axis * h;
+    float radialLength = radial.length();
+
+    math::Vec3 radialDir = radialLength > 1e-6f ? radial / radialLength : geometry::perpendicular(axis);
+
+    // center outside: distance to clamped point
+    if (std::abs(h) > halfHeight || radialLength > radius)
+    {
+        math::Vec3 closest = cylinder.getPosition() + axis * std::clamp(h, -halfHeight, halfHeight) + radialDir * std::min(radialLength, radius);
+        return geometry::sphereContact(m_position, m_radius, closest, 0.0f, radialDir * -1.0f, outInfo);
+    }
+
+    // center inside: push out through nearest cap or side
+    float capDistance = halfHeight - std::abs(h);
+    float sideDistance = radius - radialLength;
+
+    if (capDistance < sideDistance)
+    {
+        outInfo.normal = h > 0.0f ? axis * -1.0f : axis;
+        outInfo.penetration = m_radius + capDistance;
+    }
+    else
+    {
+        outInfo.normal = radialDir * -1.0f;
+        outInfo.penetration = m_radius + sideDistance;
+    }
+    return true;
+}
+
+// closest point on box in box frame
+bool SphereCollider::testCollisionWithBox(const BoxCollider& box, CollisionInfo& outInfo) const
+{
+    const math::Vec3* axes = box.getAxes();
+    const math::Vec3 halfSize = box.getSize() * 0.5f;
+    const float half[3] = {halfSize.x, halfSize.y, halfSize.z};
+
+    math::Vec3 d = m_position - box.getPosition();
+    float local[3] = {d.dot(axes[0]), d.dot(axes[1]), d.dot(axes[2])};
+
+    bool inside = true;
+    math::Vec3 closest = box.getPosition();
+    for (int i = 0; i < 3; i++)
+    {
+        inside = inside && std::abs(local[i]) <= half[i];
+        closest += axes[i] * std::clamp(local[i], -half[i], half[i]);
+    }
+
+    if (!inside)
+    {
+        return geometry::sphereContact(m_position, m_radius, closest, 0.0f, math::Vec3{0.0f, 1.0f, 0.0f}, outInfo);
+    }
+
+    // center inside: push out through nearest face
+    int face = 0;
+    float faceDistance = half[0] - std::abs(local[0]);
+    for (int i = 1; i < 3; i++)
+    {
+        float distance = half[i] - std::abs(local[i]);
+        if (distance < faceDistance)
+        {
+            faceDistance = distance;
+            face = i;
+        }
+    }
+
+    outInfo.normal = local[face] > 0.0f ? axes[face] * -1.0f : axes[face];
+    outInfo.penetration = m_radius + faceDistance;
+    return true;
+}
+
+bool SphereCollider::testCollisionWithGround(const GroundCollider& ground, CollisionInfo& outInfo) const
+{
+    float lowestY = m_position.y - m_radius;
+    if (lowestY < ground.getGroundY())
+    {
+        outInfo.normal = math::Vec3{0.0f, 1.0f, 0.0f};
+        outInfo.penetration = ground.getGroundY() - lowestY;
+        return true;
+    }
+
+    return false;
+}
+
+bool SphereCollider::testCollisionWithHeightfield(const HeightfieldCollider& heightfield, CollisionInfo& outInfo) const
+{
+    return heightfield.getSphereContact(m_position, m_radius, outInfo);
+}
+
+} // namespace collision
+} // namespace BulletPhysics
@@ -0,0 +1,49 @@
+/*
+ * SphereCollider.h
+ */
+
+#pragma once
+
+#include "Collider.h"
+
+namespace BulletPhysics {
+namespace collision {
+
+class BoxCollider;
+class GroundCollider;
+class HeightfieldCollider;
+class CapsuleCollider;
+class CylinderCollider;
+
+// sphere around position (similar to SphereShape3D in Godot)
+class SphereCollider : public Collider {
+public:
+    explicit SphereCollider(float radius = 0.5f);
+
+    CollisionShape getShape() const override { return CollisionShape::Sphere; }
+    const math::Vec3& getPosition() const override { return m_position; }
+    void setPosition(const math::Vec3& pos) override { m_position = pos; }
+
+    AABB getBounds() const override;
+
+    float getRadius() const { return m_radius; }
+    void setRadius(float radius) { m_radius = radius; }
+
+    bool testPoint(const math::Vec3& point) const override;
+    bool testSegment(const math::Vec3& start, const math::Vec3& end, SweepInfo& outInfo) const override;
+    bool testSweptSphere(const math::Vec3& start, const math::Vec3& end, float radius, SweepInfo& outInfo) const override;
+
+    bool testCollisionWithSphere(const SphereCollider& sphere, CollisionInfo& outInfo) const;
+    bool testCollisionWithCapsule(const CapsuleCollider& capsule, CollisionInfo& outInfo) const;
+    bool testCollisionWithCylinder(const CylinderCollider& cylinder, CollisionInfo& outInfo) const;
+    bool testCollisionWithBox(const BoxCollider& box, CollisionInfo& outInfo) const;
+    bool testCollisionWithGround(const GroundCollider& ground, CollisionInfo& outInfo) const;
+    bool testCollisionWithHeightfield(const HeightfieldCollider& heightfield, CollisionInfo& outInfo) const;
+
+private:
+    math::Vec3 m_position{};
+    float m_radius;
+};
+
+} // namespace collision
+} // namespace BulletPhysics
@@ -0,0 +1,100 @@
+/*
+ * ThreadPool.cpp
+ */
+
+#include "ThreadPool.h"
+
+namespace BulletPhysics {
+namespace collision {
+
+ThreadPool::ThreadPool(size_t threadCount)
+{
+    for (size_t i = 1; i < threadCount; i++)
+    {
+        m_workers.emplace_back([this] { workerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_startCondition.notify_all();
+
+    for (std::thread& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+void ThreadPool::run(size_t taskCount, const std::function<void(size_t)>& task)
+{
+    if (m_workers.empty() || taskCount <= 1)
+    {
+        for (size_t i = 0; i < taskCount; i++)
+        {
+            task(i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_task = &task;
+        m_taskCount = taskCount;
+        m_nextTask.store(0, std::memory_order_relaxed);
+        m_busyWorkers = m_workers.size();
+        m_generation++;
+    }
+    m_startCondition.notify_all();
+
+    drain();
+
+    // workers still finishing their last task reference batch state
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_doneCondition.wait(lock, [this] { return m_busyWorkers == 0; });
+    m_task = nullptr;
+}
+
+void ThreadPool::workerLoop()
+{
+    uint64_t seenGeneration = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_startCondition.wait(lock, [&] { return m_stopping || m_generation != seenGeneration; });
+            if (m_stopping)
+            {
+                return;
+            }
+            seenGeneration = m_generation;
+        }
+
+        drain();
+
+        bool last;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            last = --m_busyWorkers == 0;
+        }
+        if (last)
+        {
+            m_doneCondition.notify_one();
+        }
+    }
+}
+
+void ThreadPool::drain()
+{
+    for (size_t i = m_nextTask.fetch_add(1, std::memory_order_relaxed); i < m_taskCount; i = m_nextTask.fetch_add(1, std::memory_order_relaxed))
+    {
+        (*m_task)(i);
+    }
+}
+
+} // namespace collision
+} // namespace BulletPhysics
@@ -0,0 +1,54 @@
+/*
+ * ThreadPool.h
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace BulletPhysics {
+namespace collision {
+
+// fixed set of worker threads running indexed task batches,
+// calling thread takes part in every batch so pool of size n spawns n - 1 workers
+class ThreadPool {
+public:
+    explicit ThreadPool(size_t threadCount);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    size_t size() const { return m_workers.size() + 1; }
+
+    // call task(i) for every i in [0, taskCount) and wait until all are done,
+    // tasks are picked in index order but may finish in any order
+    void run(size_t taskCount, const std::function<void(size_t)>& task);
+
+private:
+    std::vector<std::thread> m_workers;
+
+    std::mutex m_mutex;
+    std::condition_variable m_startCondition;
+    std::condition_variable m_doneCondition;
+
+    const std::function<void(size_t)>* m_task = nullptr;
+    size_t m_taskCount = 0;
+    std::atomic<size_t> m_nextTask{0};
+    size_t m_busyWorkers = 0;
+    uint64_t m_generation = 0;      // bumped per batch, wakes workers
+    bool m_stopping = false;
+
+    void workerLoop();
+    void drain();
+};
+
+} // namespace collision
+} // namespace BulletPhysics
@@ -0,0 +1,240 @@
+/*
+ * BodyPool.h
+ */
+
+#pragma once
+
+#include "PhysicsBody.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace BulletPhysics {
+namespace dynamics {
+
+// generational handle of pooled body, goes stale when its body is despawned (slot generation moves on)
+template <typename Body>
+struct BodyHandle {
+    static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+    uint32_t index = INVALID_INDEX;     // slot
+    uint32_t generation = 0;
+
+    bool valid() const { return index != INVALID_INDEX; }
+    bool operator==(const BodyHandle&) const = default;
+};
+
+// bodies of one type packed densely in fixed-size chunks: spawn appends, despawn moves last body into hole,
+// slots map handles to dense positions; chunks are kept for reuse, so steady churn does not allocate,
+// body addresses stay valid until next despawn
+template <typename Body, size_t ChunkSize = 256>
+class BodyStorage {
+public:
+    using Handle = BodyHandle<Body>;
+
+    BodyStorage() = default;
+    BodyStorage(const BodyStorage&) = delete;
+    BodyStorage& operator=(const BodyStorage&) = delete;
+    ~BodyStorage() { clear(); }
+
+    template <typename... Args>
+    Handle spawn(Args&&... args)
+    {
+        const uint32_t dense = static_cast<uint32_t>(m_count);
+        if (dense / ChunkSize == m_chunks.size())
+        {
+            m_chunks.push_back(std::make_unique<Cell[]>(ChunkSize));
+        }
+        ::new (static_cast<void*>(cell(dense))) Body(std::forward<Args>(args)...);
+
+        // reuse free slot or append one
+        uint32_t slot = m_freeHead;
+        if (slot != Handle::INVALID_INDEX)
+        {
+            m_freeHead = m_slots[slot].dense;
+        }
+        else
+        {
+            slot = static_cast<uint32_t>(m_slots.size());
+            m_slots.push_back({0, 0});
+        }
+
+        m_slots[slot].dense = dense;
+        m_denseToSlot.push_back(slot);
+        m_count++;
+
+        return {slot, m_slots[slot].generation};
+    }
+
+    // false for stale handle
+    bool despawn(Handle handle)
+    {
+        if (!contains(handle))
+        {
+            return false;
+        }
+
+        Slot& slot = m_slots[handle.index];
+        const uint32_t dense = slot.dense;
+        const uint32_t last = static_cast<uint32_t>(m_count - 1);
+
+        if (dense != last)
+        {
+            at(dense) = std::move(at(last));
+            m_denseToSlot[dense] = m_denseToSlot[last];
+            m_slots[m_denseToSlot[dense]].dense = dense;
+        }
+        std::destroy_at(&at(last));
+        m_denseToSlot.pop_back();
+        m_count--;
+
+        // free slots are chained through dense field
+        slot.generation++;
+        slot.dense = m_freeHead;
+        m_freeHead = handle.index;
+        return true;
+    }
+
+    bool contains(Handle handle) const
+    {
+        return handle.index < m_slots.size() && m_slots[handle.index].generation == handle.generation;
+    }
+
+    // null for stale handle
+    Body* get(Handle handle) { return contains(handle) ? &at(m_slots[handle.index].dense) : nullptr; }
+    const Body* get(Handle handle) const { return contains(handle) ? &at(m_slots[handle.index].dense) : nullptr; }
+
+    // dense access, index in [0, size)
+    Body& at(size_t dense) { return *std::launder(reinterpret_cast<Body*>(cell(dense))); }
+    const Body& at(size_t dense) const { return *std::launder(reinterpret_cast<const Body*>(cell(dense))); }
+
+    // handle of body at dense index; to despawn while iterating walk dense indices down from size() - 1
+    Handle handleAt(size_t dense) const
+    {
+        const uint32_t slot = m_denseToSlot[dense];
+        return {slot, m_slots[slot].generation};
+    }
+
+    size_t size() const { return m_count; }
+    size_t capacity() const { return m_chunks.size() * ChunkSize; }
+
+    // live bodies chunk by chunk, fn must not spawn or despawn
+    template <typename Fn>
+    void forEach(Fn&& fn)
+    {
+        for (size_t c = 0, begin = 0; begin < m_count; c++, begin += ChunkSize)
+        {
+            Body* bodies = std::launder(reinterpret_cast<Body*>(m_chunks[c].get()));
+            const size_t end = std::min(m_count - begin, ChunkSize);
+            for (size_t i = 0; i < end; i++)
+            {
+                fn(bodies[i]);
+            }
+        }
+    }
+
+    // despawns all, outstanding handles go stale, chunks are kept
+    void clear()
+    {
+        for (size_t i = 0; i < m_count; i++)
+        {
+            std::destroy_at(&at(i));
+        }
+
+        for (uint32_t dense = 0; dense < m_count; dense++)
+        {
+            Slot& slot = m_slots[m_denseToSlot[dense]];
+            slot.generation++;
+            slot.dense = m_freeHead;
+            m_freeHead = m_denseToSlot[dense];
+        }
+
+        m_denseToSlot.clear();
+        m_count = 0;
+    }
+
+private:
+    struct alignas(Body) Cell {
+        std::byte bytes[sizeof(Body)];
+    };
+
+    struct Slot {
+        uint32_t dense;         // position of body, next free slot while unused
+        uint32_t generation;
+    };
+
+    std::vector<std::unique_ptr<Cell[]>> m_chunks;
+    std::vector<Slot> m_slots;
+    std::vector<uint32_t> m_denseToSlot;
+    uint32_t m_freeHead = Handle::INVALID_INDEX;
+    size_t m_count = 0;
+
+    Cell* cell(size_t dense) const { return &m_chunks[dense / ChunkSize][dense % ChunkSize]; }
+};
+
+// one BodyStorage per body type, bodies of different types never share chunk
+template <typename... Bodies>
+class BodyPool {
+public:
+    template <typename Body, typename... Args>
+    BodyHandle<Body> spawn(Args&&... args) { return storage<Body>().spawn(std::forward<Args>(args)...); }
+
+    template <typename Body>
+    bool despawn(BodyHandle<Body> handle) { return storage<Body>().despawn(handle); }
+
+    template <typename Body>
+    Body* get(BodyHandle<Body> handle) { return storage<Body>().get(handle); }
+
+    template <typename Body>
+    bool contains(BodyHandle<Body> handle) const { return storage<Body>().contains(handle); }
+
+    template <typename Body>
+    BodyStorage<Body>& storage() { return std::get<BodyStorage<Body>>(m_storages); }
+
+    template <typename Body>
+    const BodyStorage<Body>& storage() const { return std::get<BodyStorage<Body>>(m_storages); }
+
+    size_t size() const { return std::apply([](const auto&... storages) { return (storages.size() + ... + 0); }, m_storages); }
+
+    // every live body, type by type; fn takes body of each type (or IPhysicsBody&)
+    template <typename Fn>
+    void forEach(Fn&& fn)
+    {
+        std::apply([&fn](auto&... storages) { (storages.forEach(fn), ...); }, m_storages);
+    }
+
+    // fn(storage, typeIndex) for each body type in declaration order
+    template <typename Fn>
+    void forEachStorage(Fn&& fn)
+    {
+        forEachStorage(fn, std::index_sequence_for<Bodies...>{});
+    }
+
+    static constexpr size_t typeCount() { return sizeof...(Bodies); }
+
+    void clear()
+    {
+        std::apply([](auto&... storages) { (storages.clear(), ...); }, m_storages);
+    }
+
+private:
+    std::tuple<BodyStorage<Bodies>...> m_storages;
+
+    template <typename Fn, size_t... I>
+    void forEachStorage(Fn& fn, std::index_sequence<I...>)
+    {
+        (fn(std::get<I>(m_storages), I), ...);
+    }
+};
+
+// pool of library body types
+using DefaultBodyPool = BodyPool<RigidBody, RigidBody6DOF, projectile::ProjectileRigidBody, projectile::ProjectileRigidBody6DOF>;
+
+} // namespace dynamics
+} // namespace BulletPhysics
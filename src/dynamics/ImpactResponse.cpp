@@ -0,0 +1,213 @@
+/*
+ * ImpactResponse.cpp
+ */
+
+#include "ImpactResponse.h"
+#include "ProjectileStore.h"
+#include "math/Transcendental.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace BulletPhysics {
+namespace dynamics {
+
+void ImpactResponse::addProjectile(uint32_t colliderId, projectile::IProjectileBody* body)
+{
+    if (colliderId == collision::INVALID_COLLIDER_ID)
+    {
+        return;
+    }
+
+    if (colliderId >= m_projectiles.size())
+    {
+        m_projectiles.resize(colliderId + 1);
+    }
+    m_projectiles[colliderId] = {body, m_frame};
+}
+
+void ImpactResponse::removeProjectile(uint32_t colliderId)
+{
+    if (colliderId < m_projectiles.size())
+    {
+        m_projectiles[colliderId].body = nullptr;
+    }
+}
+
+void ImpactResponse::clear()
+{
+    m_projectiles.clear();
+    m_inputs.clear();
+    m_results.clear();
+}
+
+const std::vector<ImpactResult>& ImpactResponse::resolve(const std::vector<collision::Manifold>& manifolds)
+{
+    m_frame++;
+
+    gather(manifolds);
+    respond();
+    apply();
+
+    return m_results;
+}
+
+projectile::IProjectileBody* ImpactResponse::findProjectile(uint32_t colliderId)
+{
+    return colliderId < m_projectiles.size() ? m_projectiles[colliderId].body : nullptr;
+}
+
+void ImpactResponse::gather(const std::vector<collision::Manifold>& manifolds)
+{
+    m_inputs.clear();
+    m_results.clear();
+
+    for (const collision::Manifold& manifold : manifolds)
+    {
+        projectile::IProjectileBody* bodyA = findProjectile(manifold.idA);
+        projectile::IProjectileBody* bodyB = findProjectile(manifold.idB);
+
+        // projectile against projectile or two static colliders
+        if ((bodyA != nullptr) == (bodyB != nullptr))
+        {
+            continue;
+        }
+
+        const bool projectileFirst = bodyA != nullptr;
+        Projectile& projectile = m_projectiles[projectileFirst ? manifold.idA : manifold.idB];
+        if (projectile.frame == m_frame)
+        {
+            continue;
+        }
+
+        const collision::Collider* target = projectileFirst ? manifold.colliderB : manifold.colliderA;
+
+        // manifold normal points from first collider to second, terrain reports its own surface normal
+        const collision::CollisionShape shape = target->getShape();
+        const bool terrain = shape == collision::CollisionShape::Ground || shape == collision::CollisionShape::Heightfield;
+        const math::Vec3 normal = terrain || !projectileFirst ? manifold.info.normal : manifold.info.normal * -1.0f;
+
+        const math::Vec3 velocity = projectile.body->getVelocity();
+        const float speed = velocity.length();
+        const float approach = -velocity.dot(normal);
+
+        // separating or resting contact
+        if (speed < 1e-3f || approach <= 0.0f)
+        {
+            continue;
+        }
+
+        projectile.frame = m_frame;
+
+        const float sinGrazing = std::min(approach / speed, 1.0f);
+
+        m_inputs.push_back({speed, sinGrazing, projectile.body->getMass(), projectile.body->getLoad().area,
+                            manifold.info.penetration, target->getMaterial(), 0.0f, 0.0f, 0.0f});
+        m_results.push_back({projectile.body, target, ImpactOutcome::Ricochet, normal, velocity, velocity, math::fp::asin(sinGrazing), 0.0f});
+    }
+}
+
+void ImpactResponse::respond()
+{
+    constexpr float infinity = std::numeric_limits<float>::infinity();
+
+    for (size_t i = 0; i < m_inputs.size(); i++)
+    {
+        ImpactInput& input = m_inputs[i];
+        ImpactResult& result = m_results[i];
+        const collision::Material& material = input.material;
+
+        if (result.grazingAngle < material.ricochetAngle)
+        {
+            // restitution fades from its grazing value to 0 at critical angle
+            const float restitution = material.restitution * (1.0f - result.grazingAngle / material.ricochetAngle);
+
+            // tangential impulse bounded by friction times normal impulse (1 + e) * vn
+            const float normalSpeed = input.speed * input.sinGrazing;
+            const float tangentSpeed = input.speed * std::sqrt(std::max(0.0f, 1.0f - input.sinGrazing * input.sinGrazing));
+            const float tangentLoss = material.friction * (1.0f + restitution) * normalSpeed;
+
+            result.outcome = ImpactOutcome::Ricochet;
+            input.normalScale = restitution;
+            input.tangentScale = tangentSpeed > 0.0f ? std::max(0.0f, 1.0f - tangentLoss / tangentSpeed) : 0.0f;
+            continue;
+        }
+
+        // path through plate along trajectory
+        const float path = material.thickness / input.sinGrazing;
+        const float speedSq = input.speed * input.speed;
+
+        float stopDepth;
+        float exitSpeedSq;
+        if (material.density > 0.0f)
+        {
+            // v^2(x) = (v0^2 + R / rho) * exp(-2 * rho * A * x / m) - R / rho
+            const float k = 2.0f * material.density * input.area / input.mass;
+            const float c = material.resistance / material.density;
+
+            stopDepth = c > 0.0f ? math::fp::log1p(speedSq / c) / k : math::fp::log(std::max(speedSq / (STOP_SPEED * STOP_SPEED), 1.0f)) / k;
+            exitSpeedSq = path < stopDepth ? (speedSq + c) * math::fp::exp(-k * path) - c : 0.0f;
+        }
+        else if (material.resistance > 0.0f)
+        {
+            // constant force: kinetic energy spent on R * A per unit length
+            const float k = 2.0f * material.resistance * input.area / input.mass;
+
+            stopDepth = speedSq / k;
+            exitSpeedSq = path < stopDepth ? speedSq - k * path : 0.0f;
+        }
+        else
+        {
+            stopDepth = infinity;
+            exitSpeedSq = speedSq;
+        }
+
+        // no resistance at all lets projectile pass unaffected even through unbounded target
+        if (path < stopDepth || stopDepth == infinity)
+        {
+            result.outcome = ImpactOutcome::Perforation;
+            result.pathLength = path < infinity ? path : 0.0f;
+            input.exitSpeed = std::sqrt(std::max(0.0f, exitSpeedSq));
+        }
+        else
+        {
+            result.outcome = ImpactOutcome::Embedded;
+            result.pathLength = stopDepth;
+            input.exitSpeed = 0.0f;
+        }
+    }
+}
+
+void ImpactResponse::apply()
+{
+    for (size_t i = 0; i < m_inputs.size(); i++)
+    {
+        const ImpactInput& input = m_inputs[i];
+        ImpactResult& result = m_results[i];
+        projectile::IProjectileBody& body = *result.body;
+
+        if (result.outcome == ImpactOutcome::Ricochet)
+        {
+            // split into normal and tangential parts, push out of overlap so next frame does not hit again
+            const float normalSpeed = input.speed * input.sinGrazing;
+            const math::Vec3 tangent = result.velocityIn + result.normal * normalSpeed;
+
+            result.velocityOut = tangent * input.tangentScale + result.normal * (normalSpeed * input.normalScale);
+            body.setPosition(body.getPosition() + result.normal * input.penetration);
+        }
+        else
+        {
+            // travel along trajectory, taken from current position (contact is found after overlap, not at entry)
+            const math::Vec3 direction = result.velocityIn / input.speed;
+
+            result.velocityOut = direction * input.exitSpeed;
+            body.setPosition(body.getPosition() + direction * result.pathLength);
+        }
+
+        body.setVelocity(result.velocityOut);
+    }
+}
+
+} // namespace dynamics
+} // namespace BulletPhysics
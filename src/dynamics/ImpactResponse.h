@@ -0,0 +1,85 @@
+/*
+ * ImpactResponse.h
+ */
+
+#pragma once
+
+#include "PhysicsBody.h"
+#include "collision/CollisionDetection.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace BulletPhysics {
+namespace dynamics {
+
+enum class ImpactOutcome {
+    Ricochet,       // deflected off surface
+    Embedded,       // stopped inside target
+    Perforation     // passed through plate, continues with exit velocity
+};
+
+struct ImpactResult {
+    projectile::IProjectileBody* body;
+    const collision::Collider* target;
+    ImpactOutcome outcome;
+
+    math::Vec3 normal;          // target surface normal, towards projectile
+    math::Vec3 velocityIn;      // m/s
+    math::Vec3 velocityOut;     // m/s
+    float grazingAngle;         // rad, between trajectory and surface (pi/2 is head-on)
+    float pathLength;           // m, distance travelled inside target (0 for ricochet)
+};
+
+// projectile response to manifolds of one frame, using target collider material:
+// impacts shallower than critical grazing angle ricochet with angle-dependent restitution and friction loss,
+// others penetrate by Poncelet equation m * dv/dx = -A * (R + rho * v^2), embedding or perforating plates
+class ImpactResponse {
+public:
+    // m/s, target with density but no strength (R = 0) only slows projectile exponentially, below this it counts as stopped
+    static constexpr float STOP_SPEED = 1.0f;
+
+    // register projectile body behind collider id returned by CollisionDetection::addCollider
+    void addProjectile(uint32_t colliderId, projectile::IProjectileBody* body);
+    void removeProjectile(uint32_t colliderId);
+    void clear();
+
+    // respond to every manifold with exactly one registered projectile approaching target,
+    // each projectile reacts once per call (first manifold in id order), bodies get new velocity and position
+    const std::vector<ImpactResult>& resolve(const std::vector<collision::Manifold>& manifolds);
+    const std::vector<ImpactResult>& getResults() const { return m_results; }
+
+private:
+    struct Projectile {
+        projectile::IProjectileBody* body = nullptr;
+        uint32_t frame = 0;     // last resolve call that handled it
+    };
+
+    // plain scalars of one impact, filled by gather pass so response pass makes no virtual calls
+    struct ImpactInput {
+        float speed;
+        float sinGrazing;
+        float mass;
+        float area;
+        float penetration;      // overlap depth from narrowphase
+        collision::Material material;
+
+        // response pass output
+        float normalScale;      // outgoing normal speed per incoming normal speed (ricochet)
+        float tangentScale;     // retained tangential velocity fraction (ricochet)
+        float exitSpeed;        // m/s (penetration)
+    };
+
+    std::vector<Projectile> m_projectiles;     // indexed by collider id
+    std::vector<ImpactInput> m_inputs;          // parallel to m_results
+    std::vector<ImpactResult> m_results;
+    uint32_t m_frame = 0;
+
+    projectile::IProjectileBody* findProjectile(uint32_t colliderId);
+    void gather(const std::vector<collision::Manifold>& manifolds);
+    void respond();
+    void apply();
+};
+
+} // namespace dynamics
+} // namespace BulletPhysics
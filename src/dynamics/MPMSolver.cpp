@@ -0,0 +1,171 @@
+/*
+ * MPMSolver.cpp
+ */
+
+#include "MPMSolver.h"
+#include "math/Transcendental.h"
+
+#include <cmath>
+
+namespace BulletPhysics {
+namespace dynamics {
+
+template <typename T>
+const MPMProjectile& MPMSolverT<T>::prepare(const projectile::ProjectileSpecs& specs)
+{
+    return projectile::ProjectileStore::shared().intern(specs);
+}
+
+template <typename T>
+typename MPMSolverT<T>::Environment MPMSolverT<T>::sampleEnvironment(IPhysicsBody& body)
+{
+    Environment environment{constants::BASE_ATMOSPHERIC_DENSITY, constants::BASE_SPEED_OF_SOUND, forces::drag::airViscosity(constants::BASE_TEMPERATURE),
+                            {}, Vec(constants::GRAVITY), {}};
+    if (!m_world)
+    {
+        return environment;
+    }
+
+    const PhysicsContext& context = m_world->updateContext(body);
+
+    environment.density = context.airDensity.value_or(constants::BASE_ATMOSPHERIC_DENSITY);
+    environment.wind = Vec(context.wind.value_or(math::Vec3{}));
+
+    // c = sqrt(gamma * R * T)
+    if (context.airTemperature)
+    {
+        environment.speedOfSound = std::sqrt(static_cast<T>(constants::HEAT_CAPACITY_RATIO * constants::GAS_CONSTANT_DRY_AIR * *context.airTemperature));
+        environment.viscosity = forces::drag::airViscosity(*context.airTemperature);
+    }
+
+    if (context.gravity)
+    {
+        environment.gravity = {0, static_cast<T>(-*context.gravity), 0};
+    }
+
+    if (context.latitude)
+    {
+        const double latitude = *context.latitude;
+        environment.earthRotation = Vec(math::Vec3d(0.0, math::fp::sin(latitude), math::fp::cos(latitude)) * constants::EARTH_ANGULAR_SPEED);
+    }
+
+    return environment;
+}
+
+template <typename T>
+typename MPMSolverT<T>::Derivative MPMSolverT<T>::evaluate(const MPMProjectile& projectile, const Environment& environment, const Vec& velocity, T spinRate)
+{
+    // Coriolis: a = -2 * (omega x v)
+    Vec acceleration = environment.gravity - environment.earthRotation.cross(velocity) * T(2);
+
+    const Vec airVelocity = velocity - environment.wind;
+    const T speed = airVelocity.length();
+    if (speed < T(1e-3))
+    {
+        return {acceleration, 0};
+    }
+
+    // shared intermediates
+    const T rhoS = environment.density * projectile.area;
+    const T halfRhoSV = T(0.5) * rhoS * speed;
+    const T inverseMass = T(1) / projectile.mass;
+
+    // drag: a = -1/2 * rho * S * Cd * |v| * v / m, C_d * S from float load table
+    const T mach = speed / environment.speedOfSound;
+    T dragArea;
+    if (projectile.reynoldsDependent())
+    {
+        // Re = rho * |v| * d / mu
+        const T reynolds = environment.density * speed * projectile.diameter / environment.viscosity;
+        dragArea = projectile.dragAreaAt(static_cast<float>(mach), static_cast<float>(speed), static_cast<float>(reynolds));
+    }
+    else
+    {
+        dragArea = projectile.dragAreaAt(static_cast<float>(mach), static_cast<float>(speed));
+    }
+    acceleration -= airVelocity * (T(0.5) * environment.density * speed * dragArea * inverseMass);
+
+    if (!projectile.spinning || spinRate == 0)
+    {
+        return {acceleration, 0};
+    }
+
+    // yaw of repose: alpha_e = 2 * Ix * p * (g x v) / (rho * S * d * v^4 * C_M_alpha)
+    const T speedSq = speed * speed;
+    const T yawScale = projectile.spinSign * T(2) * projectile.axialInertia * spinRate
+                     / (rhoS * projectile.diameter * speedSq * speedSq * projectile.overturningCoefficient);
+    const Vec yaw = environment.gravity.cross(airVelocity) * yawScale;
+
+    // lift: a = 1/2 * rho * S * C_L_alpha * v^2 * alpha_e / m
+    acceleration += yaw * (halfRhoSV * speed * projectile.liftCoefficient * inverseMass);
+
+    // Magnus: a = -1/2 * rho * S * d * p * C_mag_f * (alpha_e x v) / m
+    acceleration -= yaw.cross(airVelocity) * (T(0.5) * rhoS * projectile.diameter * spinRate * projectile.magnusCoefficient * inverseMass);
+
+    // spin decay: dp/dt = rho * S * d^2 * p * v * C_spin / (2 * Ix)
+    const T spinAcceleration = halfRhoSV * projectile.diameter * projectile.diameter * spinRate * projectile.rollDampingAt(static_cast<float>(mach)) / projectile.axialInertia;
+
+    return {acceleration, spinAcceleration};
+}
+
+template <typename T>
+void MPMSolverT<T>::integrate(const MPMProjectile& projectile, const Environment& environment, State& state, T dt)
+{
+    const Vec v0 = state.velocity;
+    const T p0 = state.spinRate;
+    const T half = dt * T(0.5);
+
+    const Derivative k1 = evaluate(projectile, environment, v0, p0);
+
+    const Vec v1 = v0 + k1.acceleration * half;
+    const Derivative k2 = evaluate(projectile, environment, v1, p0 + k1.spinAcceleration * half);
+
+    const Vec v2 = v0 + k2.acceleration * half;
+    const Derivative k3 = evaluate(projectile, environment, v2, p0 + k2.spinAcceleration * half);
+
+    const Vec v3 = v0 + k3.acceleration * dt;
+    const Derivative k4 = evaluate(projectile, environment, v3, p0 + k3.spinAcceleration * dt);
+
+    // position rates are stage velocities
+    const T sixth = dt / T(6);
+    state.position += (v0 + (v1 + v2) * T(2) + v3) * sixth;
+    state.velocity += (k1.acceleration + (k2.acceleration + k3.acceleration) * T(2) + k4.acceleration) * sixth;
+    state.spinRate += (k1.spinAcceleration + (k2.spinAcceleration + k3.spinAcceleration) * T(2) + k4.spinAcceleration) * sixth;
+}
+
+template <typename T>
+void MPMSolverT<T>::step(const MPMProjectile& projectile, State& state, T dt)
+{
+    m_probe.setPosition(math::Vec3(state.position));
+    m_probe.setVelocity(math::Vec3(state.velocity));
+
+    integrate(projectile, sampleEnvironment(m_probe), state, dt);
+}
+
+template <typename T>
+void MPMSolverT<T>::step(std::vector<Body>& bodies, T dt)
+{
+    for (Body& body : bodies)
+    {
+        step(*body.projectile, body.state, dt);
+    }
+}
+
+template <typename T>
+void MPMSolverT<T>::step(projectile::IProjectileBody& body, T dt)
+{
+    const MPMProjectile& projectile = body.getLoad();
+
+    State state{Vec(body.getPosition()), Vec(body.getVelocity()), body.getSpinRate()};
+    integrate(projectile, sampleEnvironment(body), state, dt);
+
+    body.setPosition(math::Vec3(state.position));
+    body.setVelocity(math::Vec3(state.velocity));
+    body.setSpinRate(static_cast<float>(state.spinRate));
+}
+
+template class MPMSolverT<float>;
+template class MPMSolverT<double>;
+
+} // namespace dynamics
+} // namespace BulletPhysics
@@ -0,0 +1,100 @@
+/*
+ * MPMSolver.h
+ */
+
+#pragma once
+
+#include "PhysicsBody.h"
+#include "PhysicsWorld.h"
+#include "ProjectileStore.h"
+
+#include <vector>
+
+namespace BulletPhysics {
+namespace dynamics {
+
+// projectile constants for MPM are those of interned load
+using MPMProjectile = projectile::ProjectileLoad;
+
+// point mass state with spin rate
+template <typename T>
+struct MPMStateT {
+    math::Vec3T<T> position;
+    math::Vec3T<T> velocity;
+    T spinRate = 0;                 // rad/s
+};
+
+template <typename T>
+struct MPMBodyT {
+    const MPMProjectile* projectile;
+    MPMStateT<T> state;
+};
+
+// modified point mass trajectory model (STANAG 4355 style): drag, lift and Magnus from yaw of repose,
+// gravity, Coriolis and spin decay evaluated in one kernel sharing |v|, rho * S and yaw of repose,
+// world environments are sampled once per step at its start, world forces are not used;
+// state and kernel run in T, projectile constants and environments stay float
+template <typename T>
+class MPMSolverT {
+public:
+    using Scalar = T;
+    using Vec = math::Vec3T<T>;
+    using State = MPMStateT<T>;
+    using Body = MPMBodyT<T>;
+
+    explicit MPMSolverT(PhysicsWorld* world = nullptr) : m_world(world) {}
+
+    // constants for projectile, interned in ProjectileStore::shared()
+    const MPMProjectile& prepare(const projectile::ProjectileSpecs& specs);
+
+    // one RK4 step of state
+    void step(const MPMProjectile& projectile, State& state, T dt);
+
+    // step all bodies
+    void step(std::vector<Body>& bodies, T dt);
+
+    // step body in place, spin rate is read from and written back to body
+    void step(projectile::IProjectileBody& body, T dt);
+
+private:
+    // air and geography at step start
+    struct Environment {
+        T density;
+        T speedOfSound;
+        T viscosity;                // dynamic, Pa * s
+        Vec wind;
+        Vec gravity;
+        Vec earthRotation;          // world frame (x east, y up, z north), zero without geography
+    };
+
+    struct Derivative {
+        Vec acceleration;
+        T spinAcceleration;
+    };
+
+    PhysicsWorld* m_world;
+    RigidBody m_probe;      // carries state into environments for batch steps
+
+    Environment sampleEnvironment(IPhysicsBody& body);
+
+    // fused MPM right-hand side
+    static Derivative evaluate(const MPMProjectile& projectile, const Environment& environment, const Vec& velocity, T spinRate);
+
+    static void integrate(const MPMProjectile& projectile, const Environment& environment, State& state, T dt);
+};
+
+// float for game-rate simulation, double keeps sub-millimetre position over fire-control ranges
+using MPMState = MPMStateT<float>;
+using MPMBody = MPMBodyT<float>;
+using MPMSolver = MPMSolverT<float>;
+
+using MPMStated = MPMStateT<double>;
+using MPMBodyd = MPMBodyT<double>;
+using MPMSolverd = MPMSolverT<double>;
+
+// instantiated in MPMSolver.cpp
+extern template class MPMSolverT<float>;
+extern template class MPMSolverT<double>;
+
+} // namespace dynamics
+} // namespace BulletPhysics
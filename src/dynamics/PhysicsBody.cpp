@@ -3,6 +3,8 @@
  */
 
 #include "PhysicsBody.h"
+#include "ProjectileStore.h"
+#include "math/Transcendental.h"
 
 namespace BulletPhysics {
 namespace dynamics {
@@ -29,10 +31,10 @@ void RigidBody::setVelocityFromAngles(float speed, float elevationDeg, float azi
     const float elev = math::deg2rad(elevationDeg);
     const float azim = math::deg2rad(azimuthDeg);
 
-    const float ce = std::cos(elev);
-    const float se = std::sin(elev);
-    const float sa = std::sin(azim);
-    const float ca = std::cos(azim);
+    const float ce = math::fp::cos(elev);
+    const float se = math::fp::sin(elev);
+    const float sa = math::fp::sin(azim);
+    const float ca = math::fp::cos(azim);
 
     m_velocity = {ce * sa * speed, se * speed, ce * ca * speed};
 }
@@ -47,67 +49,156 @@ std::unique_ptr<IPhysicsBody> RigidBody::clone() const
     return std::make_unique<RigidBody>(*this);
 }
 
+// RigidBody6DOF
+
+std::unique_ptr<IPhysicsBody> RigidBody6DOF::clone() const
+{
+    return std::make_unique<RigidBody6DOF>(*this);
+}
+
 // ProjectileRigidBody
 
 namespace projectile {
 
-ProjectileRigidBody::ProjectileRigidBody(const ProjectileSpecs& specs) : RigidBody(), m_specs(specs)
+ProjectileRigidBody::ProjectileRigidBody() : ProjectileRigidBody(ProjectileSpecs{1.0f}) {}
+
+ProjectileRigidBody::ProjectileRigidBody(const ProjectileSpecs& specs) : ProjectileRigidBody(ProjectileStore::shared().intern(specs)) {}
+
+ProjectileRigidBody::ProjectileRigidBody(const ProjectileLoad& load) : RigidBody(), m_load(&load)
 {
-    setMass(specs.mass);
+    setMass(load.mass);
 
-    if (!m_specs.area.has_value() && m_specs.diameter.has_value())
+    if (load.specs.spinSpecs && load.specs.spinSpecs->spinRate)
     {
-        m_specs.area = calculateArea(m_specs.diameter.value());
+        m_spinRate = *load.specs.spinSpecs->spinRate;
+        m_spinInitialized = true;
     }
+}
+
+const ProjectileSpecs& ProjectileRigidBody::getProjectileSpecs() const
+{
+    return m_load->specs;
+}
+
+float ProjectileRigidBody::calculateSpinRate(float velocity, float twistRate, float diameter)
+{
+    // spin rate: p = 2 * pi * V / (n * d)
+    return 2.0f * math::constants::PI * velocity / (twistRate * diameter);
+}
 
-    if (m_specs.spinSpecs)
+// auto-calculate spin rate on first non-zero velocity set if not already set
+void ProjectileRigidBody::setInitialSpinRate(float velocity)
+{
+    const ProjectileSpecs& specs = m_load->specs;
+    if (m_spinInitialized || !specs.spinSpecs || velocity <= 0.0f)
     {
-        auto& spinSpecs = *m_specs.spinSpecs;
+        return;
+    }
+
+    const auto& spinSpecs = *specs.spinSpecs;
 
-        if (!spinSpecs.momentOfInertia && m_specs.diameter)
-        {
-            spinSpecs.momentOfInertia = calculateMomentOfInertiaX(m_specs.mass, *m_specs.diameter);
-        }
+    if (spinSpecs.riflingSpecs && specs.diameter)
+    {
+        m_spinRate = calculateSpinRate(velocity, spinSpecs.riflingSpecs->twistRate, *specs.diameter);
+        m_spinInitialized = true;
     }
 }
 
-float ProjectileRigidBody::calculateArea(float diameter)
+void ProjectileRigidBody::setSpinRate(float spinRate)
 {
-    // cross-sectional area: S = pi * d ^ 2 / 4
-    return math::constants::PI * diameter * diameter * 0.25f;
+    m_spinRate = spinRate;
+    m_spinInitialized = true;
 }
 
-float ProjectileRigidBody::calculateMomentOfInertiaX(float mass, float diameter)
+void ProjectileRigidBody::clearForces()
 {
-    // uniform cylinder approximation: Ix = 1/8 * m * d^2
-    return 0.125f * mass * diameter * diameter;
+    RigidBody::clearForces();
+    m_spinAcceleration = 0.0f;
 }
 
-float ProjectileRigidBody::calculateSpinRate(float velocity, float twistRate, float diameter)
+std::unique_ptr<IPhysicsBody> ProjectileRigidBody::clone() const
 {
-    // spin rate: p = 2 * pi * V / (n * d)
-    return 2.0f * math::constants::PI * velocity / (twistRate * diameter);
+    return std::make_unique<ProjectileRigidBody>(*this);
 }
 
-// auto-calculate spin rate on first velocity set if not already set
-void ProjectileRigidBody::setInitialSpinRate(float velocity)
+// ProjectileRigidBody6DOF
+
+ProjectileRigidBody6DOF::ProjectileRigidBody6DOF(const ProjectileSpecs& specs) : ProjectileRigidBody(specs)
 {
-    if (!m_specs.spinSpecs)
+    initializeInertia();
+}
+
+ProjectileRigidBody6DOF::ProjectileRigidBody6DOF(const ProjectileLoad& load) : ProjectileRigidBody(load)
+{
+    initializeInertia();
+}
+
+void ProjectileRigidBody6DOF::initializeInertia()
+{
+    const ProjectileLoad& load = getLoad();
+
+    std::optional<float> transverse;
+    if (load.specs.spinSpecs)
+    {
+        transverse = load.specs.spinSpecs->transverseMomentOfInertia;
+    }
+
+    // uniform cylinder of 4 calibers length: I_y = m * (3 * r^2 + L^2) / 12, about 11 * I_x
+    const float radius = load.diameter * 0.5f;
+    const float length = 4.0f * load.diameter;
+    const float transverseDefault = load.mass * (3.0f * radius * radius + length * length) / 12.0f;
+
+    m_inertia = {load.axialInertia, transverse.value_or(transverseDefault), transverse.value_or(transverseDefault)};
+}
+
+void ProjectileRigidBody6DOF::initializeAttitude(const math::Vec3& velocity)
+{
+    if (m_attitudeInitialized || velocity.length() < 1e-3f)
     {
         return;
     }
+    m_attitudeInitialized = true;
+
+    const math::Vec3 axis = velocity.normalized();
+    m_orientation = math::Quat::fromTo({1.0f, 0.0f, 0.0f}, axis);
 
-    auto& spinSpecs = *m_specs.spinSpecs;
+    // right-hand twist spins clockwise seen from behind, spin vector along flight direction
+    m_angularVelocity = axis * (ProjectileRigidBody::getSpinRate() * getLoad().spinSign);
+}
 
-    if (!spinSpecs.spinRate && spinSpecs.riflingSpecs && m_specs.diameter)
+// before attitude is set spin is kept by base and applied on initialization
+float ProjectileRigidBody6DOF::getSpinRate() const
+{
+    if (!m_attitudeInitialized)
     {
-        spinSpecs.spinRate = calculateSpinRate(velocity, spinSpecs.riflingSpecs->twistRate, *m_specs.diameter);
+        return ProjectileRigidBody::getSpinRate();
     }
+
+    return m_angularVelocity.dot(m_orientation.rotate({1.0f, 0.0f, 0.0f})) * getLoad().spinSign;
 }
 
-std::unique_ptr<IPhysicsBody> ProjectileRigidBody::clone() const
+void ProjectileRigidBody6DOF::setSpinRate(float spinRate)
 {
-    return std::make_unique<ProjectileRigidBody>(*this);
+    if (!m_attitudeInitialized)
+    {
+        ProjectileRigidBody::setSpinRate(spinRate);
+        return;
+    }
+
+    // replace axial component, keep yaw and pitch rates
+    const math::Vec3 axis = m_orientation.rotate({1.0f, 0.0f, 0.0f});
+    m_angularVelocity += axis * (spinRate * getLoad().spinSign - m_angularVelocity.dot(axis));
+}
+
+void ProjectileRigidBody6DOF::addSpinAcceleration(float acceleration)
+{
+    const math::Vec3 axis = m_orientation.rotate({1.0f, 0.0f, 0.0f});
+    addTorque(axis * (acceleration * getLoad().spinSign * m_inertia.x));
+}
+
+std::unique_ptr<IPhysicsBody> ProjectileRigidBody6DOF::clone() const
+{
+    return std::make_unique<ProjectileRigidBody6DOF>(*this);
 }
 
 } // namespace projectile
@@ -6,17 +6,27 @@
 
 #include "Constants.h"
 #include "math/Vec3.h"
+#include "math/Quat.h"
 #include "math/Angles.h"
 #include "math/Constants.h"
 #include "forces/drag/DragModel.h"
 
+#include <algorithm>
 #include <cmath>
 #include <optional>
+#include <string>
 #include <memory>
+#include <vector>
 
 namespace BulletPhysics {
 namespace dynamics {
 
+class IRotationalBody;
+
+namespace projectile {
+class IProjectileBody;
+} // namespace projectile
+
 // base interface for all physics bodies
 class IPhysicsBody {
 public:
@@ -39,6 +49,36 @@ public:
     virtual const math::Vec3& getAccumulatedForces() const = 0;
     virtual void addForce(const math::Vec3& force) = 0;
     virtual void clearForces() = 0;
+
+    // rotational state of 6-DOF bodies, null for point-mass bodies (integrators keep 3-DOF path)
+    virtual IRotationalBody* getRotational() { return nullptr; }
+
+    // projectile state (spin), null for plain bodies
+    virtual projectile::IProjectileBody* getProjectile() { return nullptr; }
+};
+
+// interface for 6-DOF bodies, attitude and angular velocity are integrated alongside translation
+class IRotationalBody : public virtual IPhysicsBody {
+public:
+    virtual ~IRotationalBody() = default;
+
+    IRotationalBody* getRotational() override { return this; }
+
+    // principal moments of inertia in body frame, x is symmetry (projectile) axis (kg * m^2)
+    virtual const math::Vec3& getInertia() const = 0;
+
+    // attitude (body to world rotation)
+    virtual const math::Quat& getOrientation() const = 0;
+    virtual void setOrientation(const math::Quat& orientation) = 0;
+
+    // angular velocity (rad/s, world frame)
+    virtual const math::Vec3& getAngularVelocity() const = 0;
+    virtual void setAngularVelocity(const math::Vec3& angularVelocity) = 0;
+
+    // torques (N * m, world frame)
+    virtual const math::Vec3& getAccumulatedTorques() const = 0;
+    virtual void addTorque(const math::Vec3& torque) = 0;
+    virtual void clearTorques() = 0;
 };
 
 // interface for projectile bodies
@@ -53,20 +93,71 @@ struct RiflingSpecs {
 
     Direction direction;    // rifling direction
     float twistRate;        // n (calibers per turn)
+
+    bool operator==(const RiflingSpecs&) const = default;
+};
+
+// coefficient tabulated by Mach number, linear between points and clamped at ends
+struct MachTable {
+    std::vector<float> mach;        // ascending
+    std::vector<float> values;
+
+    float at(float machNumber) const
+    {
+        if (mach.empty())
+        {
+            return 0.0f;
+        }
+
+        auto upper = std::upper_bound(mach.begin(), mach.end(), machNumber);
+        if (upper == mach.begin())
+        {
+            return values.front();
+        }
+        if (upper == mach.end())
+        {
+            return values.back();
+        }
+
+        size_t i = static_cast<size_t>(upper - mach.begin());
+        float t = (machNumber - mach[i - 1]) / (mach[i] - mach[i - 1]);
+        return values[i - 1] + t * (values[i] - values[i - 1]);
+    }
+
+    bool operator==(const MachTable&) const = default;
+};
+
+// published ballistic coefficient against standard drag curve (G1, G7, ...), valid from minVelocity
+// up to next band; loads often list several bands for falling velocity
+struct BallisticCoefficient {
+    float value;                    // lb/in^2, as published
+    float minVelocity = 0.0f;       // m/s
+
+    bool operator==(const BallisticCoefficient&) const = default;
 };
 
 // spin-related specifications
 struct SpinSpecs {
     // dimensional specifications
     std::optional<float> momentOfInertia;      // I_x (kg * m^2)
+    std::optional<float> transverseMomentOfInertia;     // I_y (kg * m^2), used by 6-DOF bodies
 
     // aerodynamic coefficients
     float overtuningCoefficient = constants::DEFAULT_C_M_ALPHA;     // C_M_alpha
     float liftCoefficient = constants::DEFAULT_C_L_ALPHA;           // C_L_alpha
     float magnusCoefficient = constants::DEFAULT_C_MAG_F;           // C_mag_f
+    float rollDampingCoefficient = constants::DEFAULT_C_SPIN;       // C_spin (spin decay)
+    std::optional<MachTable> rollDampingTable;                      // C_spin by Mach, replaces constant when set
 
     std::optional<RiflingSpecs> riflingSpecs;
     std::optional<float> spinRate;              // initial spin rate (rad/s)
+
+    float rollDampingAt(float mach) const
+    {
+        return rollDampingTable ? rollDampingTable->at(mach) : rollDampingCoefficient;
+    }
+
+    bool operator==(const SpinSpecs&) const = default;
 };
 
 struct ProjectileSpecs {
@@ -78,19 +169,43 @@ struct ProjectileSpecs {
     std::optional<float> diameter;      // m (caliber)
 
     // aerodynamic coefficients
-    std::optional<forces::drag::DragCurveModel> dragModel;      // C_d
+    std::optional<forces::drag::DragCurveModel> dragModel;      // C_d, standard curve BCs and form factor refer to
+    std::optional<std::string> dragCurveFile;                   // CSV for DragCurveModel::CUSTOM, without it CUSTOM acts as unset
+    std::optional<std::string> reynoldsDragFile;                // CSV C_d(Mach, Re) matrix, replaces dragModel curve
+
+    // drag relative to dragModel curve (G1 when unset): ballistic coefficients take precedence and need only mass,
+    // form factor i = C_d / C_d_standard scales curve for own area
+    std::vector<BallisticCoefficient> ballisticCoefficients;
+    std::optional<float> formFactor;
 
     // spin-related specifications
     std::optional<SpinSpecs> spinSpecs;
+
+    bool operator==(const ProjectileSpecs&) const = default;
 };
 
+struct ProjectileLoad;
+
 // projectile interface
 class IProjectileBody : public virtual IPhysicsBody {
 public:
     virtual ~IProjectileBody() = default;
 
+    IProjectileBody* getProjectile() override { return this; }
+
     // projectile specifications
     virtual const ProjectileSpecs& getProjectileSpecs() const = 0;
+
+    // interned specs with resolved constants for hot force code
+    virtual const ProjectileLoad& getLoad() const = 0;
+
+    // spin rate (rad/s), body state integrated with translation, 0 when not spinning
+    virtual float getSpinRate() const = 0;
+    virtual void setSpinRate(float spinRate) = 0;
+
+    // spin acceleration from roll moments (rad/s^2), cleared with forces
+    virtual float getAccumulatedSpinAcceleration() const = 0;
+    virtual void addSpinAcceleration(float acceleration) = 0;
 };
 
 } // namespace projectile
@@ -130,18 +245,64 @@ private:
     math::Vec3 m_forces{};
 };
 
+// rigid body with attitude and angular velocity (6-DOF)
+class RigidBody6DOF : public RigidBody, public IRotationalBody {
+public:
+    RigidBody6DOF() = default;
+
+    std::unique_ptr<IPhysicsBody> clone() const override;
+
+    // inertia
+    const math::Vec3& getInertia() const override { return m_inertia; }
+    void setInertia(const math::Vec3& inertia) { m_inertia = inertia; }
+
+    // attitude
+    const math::Quat& getOrientation() const override { return m_orientation; }
+    void setOrientation(const math::Quat& orientation) override { m_orientation = orientation; }
+
+    // angular velocity
+    const math::Vec3& getAngularVelocity() const override { return m_angularVelocity; }
+    void setAngularVelocity(const math::Vec3& angularVelocity) override { m_angularVelocity = angularVelocity; }
+
+    // torques
+    const math::Vec3& getAccumulatedTorques() const override { return m_torques; }
+    void addTorque(const math::Vec3& torque) override { m_torques += torque; }
+    void clearTorques() override { m_torques = math::Vec3{}; }
+
+private:
+    math::Vec3 m_inertia{1.0f, 1.0f, 1.0f};
+    math::Quat m_orientation{};
+    math::Vec3 m_angularVelocity{};
+    math::Vec3 m_torques{};
+};
+
 // concrete projectile rigid body implementation
 namespace projectile {
 
+// body keeps only a pointer to its interned load (immutable, shared by all bodies of equal specs), spin rate is body state
 class ProjectileRigidBody : public RigidBody, public IProjectileBody {
 public:
-    ProjectileRigidBody() : RigidBody(), m_specs{1.0f} {}
+    ProjectileRigidBody();
+
+    // specs are interned in ProjectileStore::shared()
     explicit ProjectileRigidBody(const ProjectileSpecs& specs);
 
+    // load must outlive body (loads are never removed from their store)
+    explicit ProjectileRigidBody(const ProjectileLoad& load);
+
     std::unique_ptr<IPhysicsBody> clone() const override;
 
-    // projectile specifications
-    const ProjectileSpecs& getProjectileSpecs() const override { return m_specs; }
+    // projectile specifications, area and I_x are filled in when caliber is known
+    const ProjectileSpecs& getProjectileSpecs() const override;
+    const ProjectileLoad& getLoad() const override { return *m_load; }
+
+    // spin
+    float getSpinRate() const override { return m_spinRate; }
+    void setSpinRate(float spinRate) override;
+    float getAccumulatedSpinAcceleration() const override { return m_spinAcceleration; }
+    void addSpinAcceleration(float acceleration) override { m_spinAcceleration += acceleration; }
+
+    void clearForces() override;
 
     // override to calculate spin rate on first velocity set
     void setVelocity(const math::Vec3& vel) override
@@ -157,15 +318,71 @@ public:
     void setInitialSpinRate(float velocity);
 
 private:
-    ProjectileSpecs m_specs;
+    const ProjectileLoad* m_load;
 
+    float m_spinRate = 0.0f;
+    float m_spinAcceleration = 0.0f;
+    bool m_spinInitialized = false;     // set by specs, first velocity or setSpinRate
+
+protected:
     // helpers
-    static float calculateArea(float diameter);
-    static float calculateMomentOfInertiaX(float mass, float diameter);
     static float calculateSpinRate(float velocity, float twistRate, float diameter);
 
 };
 
+// 6-DOF projectile, on first velocity set its axis (body x) is aligned with velocity
+// and it spins at rifling spin rate around it; spin rate maps to angular velocity about that axis
+class ProjectileRigidBody6DOF : public ProjectileRigidBody, public IRotationalBody {
+public:
+    ProjectileRigidBody6DOF() = default;
+    explicit ProjectileRigidBody6DOF(const ProjectileSpecs& specs);
+    explicit ProjectileRigidBody6DOF(const ProjectileLoad& load);
+
+    std::unique_ptr<IPhysicsBody> clone() const override;
+
+    void setVelocity(const math::Vec3& vel) override
+    {
+        ProjectileRigidBody::setVelocity(vel);
+        initializeAttitude(vel);
+    }
+    void setVelocityFromAngles(float speed, float elevationDeg, float azimuthDeg) override
+    {
+        ProjectileRigidBody::setVelocityFromAngles(speed, elevationDeg, azimuthDeg);
+        initializeAttitude(getVelocity());
+    }
+
+    // spin about body x, roll moments become torque
+    float getSpinRate() const override;
+    void setSpinRate(float spinRate) override;
+    void addSpinAcceleration(float acceleration) override;
+
+    // inertia
+    const math::Vec3& getInertia() const override { return m_inertia; }
+
+    // attitude
+    const math::Quat& getOrientation() const override { return m_orientation; }
+    void setOrientation(const math::Quat& orientation) override { m_orientation = orientation; }
+
+    // angular velocity
+    const math::Vec3& getAngularVelocity() const override { return m_angularVelocity; }
+    void setAngularVelocity(const math::Vec3& angularVelocity) override { m_angularVelocity = angularVelocity; }
+
+    // torques
+    const math::Vec3& getAccumulatedTorques() const override { return m_torques; }
+    void addTorque(const math::Vec3& torque) override { m_torques += torque; }
+    void clearTorques() override { m_torques = math::Vec3{}; }
+
+private:
+    math::Vec3 m_inertia{1.0f, 1.0f, 1.0f};
+    math::Quat m_orientation{};
+    math::Vec3 m_angularVelocity{};
+    math::Vec3 m_torques{};
+    bool m_attitudeInitialized = false;
+
+    void initializeInertia();
+    void initializeAttitude(const math::Vec3& velocity);
+};
+
 } // namespace projectile
 
 } // namespace dynamics
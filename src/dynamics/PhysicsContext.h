@@ -28,6 +28,10 @@ public:
 
     std::optional<float> gravity;           // m/s^2 (gravity acceleration magnitude)
 
+    // world position of local frame origin, body positions are offsets from it (floating origin);
+    // set by PhysicsWorld, kept across reset
+    math::Vec3d origin;
+
     void reset()
     {
         airDensity.reset();
@@ -7,20 +7,30 @@
 namespace BulletPhysics {
 namespace dynamics {
 
-void PhysicsWorld::addForce(std::unique_ptr<forces::IForce> force)
+ForceId PhysicsWorld::addForce(std::unique_ptr<forces::IForce> force)
 {
-    if (force)
-    {
-        m_forces.push_back(std::move(force));
-    }
+    return m_forces.add(std::move(force));
 }
 
-void PhysicsWorld::addEnvironment(std::unique_ptr<environment::IEnvironment> environment)
+EnvironmentId PhysicsWorld::addEnvironment(std::unique_ptr<environment::IEnvironment> environment)
 {
-    if (environment)
-    {
-        m_environments.push_back(std::move(environment));
-    }
+    return m_environments.add(std::move(environment));
+}
+
+std::vector<forces::IForce*> PhysicsWorld::getForces() const
+{
+    std::vector<forces::IForce*> forces;
+    forces.reserve(m_forces.size());
+    m_forces.forEach([&](ForceId, forces::IForce& force) { forces.push_back(&force); });
+    return forces;
+}
+
+std::vector<environment::IEnvironment*> PhysicsWorld::getEnvironments() const
+{
+    std::vector<environment::IEnvironment*> environments;
+    environments.reserve(m_environments.size());
+    m_environments.forEach([&](EnvironmentId, environment::IEnvironment& environment) { environments.push_back(&environment); });
+    return environments;
 }
 
 void PhysicsWorld::clear()
@@ -29,51 +39,33 @@ void PhysicsWorld::clear()
     m_environments.clear();
 }
 
-void PhysicsWorld::applyForces(IPhysicsBody& body, float dt)
+const PhysicsContext& PhysicsWorld::updateContext(IPhysicsBody& body)
 {
     m_context.reset();
 
-    // phase 1: environment providers update context
-    for (auto& env : m_environments)
+    m_environments.forEachEnabled([&](environment::IEnvironment& env)
     {
-        if (env)
-        {
-            env->update(body, m_context);
-        }
-    }
+        BULLET_PROFILE_SCOPE(m_profiler, ProfileCategory::Environment, env.getName());
+        env.update(body, m_context);
+    });
 
-    // phase 2: forces apply using context
-    for (auto& force : m_forces)
-    {
-        if (force && force->isActive())
-        {
-            force->apply(body, m_context, dt);
-        }
-    }
+    return m_context;
 }
 
-forces::IForce* PhysicsWorld::getForce(const std::string& name)
+void PhysicsWorld::applyForces(IPhysicsBody& body, float dt)
 {
-    for (auto& force : m_forces)
-    {
-        if (force && force->getName() == name)
-        {
-            return force.get();
-        }
-    }
-    return nullptr;
-}
+    // phase 1: environment providers update context
+    updateContext(body);
 
-environment::IEnvironment* PhysicsWorld::getEnvironment(const std::string& name)
-{
-    for (auto& env : m_environments)
+    // phase 2: forces apply using context
+    m_forces.forEachEnabled([&](forces::IForce& force)
     {
-        if (env && env->getName() == name)
+        if (force.isActive())
         {
-            return env.get();
+            BULLET_PROFILE_SCOPE(m_profiler, ProfileCategory::Force, force.getName());
+            force.apply(body, m_context, dt);
         }
-    }
-    return nullptr;
+    });
 }
 
 } // namespace dynamics
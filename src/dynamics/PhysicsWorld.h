@@ -6,16 +6,258 @@
 
 #include "PhysicsContext.h"
 #include "PhysicsBody.h"
+#include "Profiler.h"
 #include "forces/Force.h"
 #include "environment/Environment.h"
 
+#include <cstdint>
 #include <vector>
 #include <memory>
-#include <string>
+#include <string_view>
+#include <unordered_map>
 
 namespace BulletPhysics {
 namespace dynamics {
 
+// generational key of force or environment registered in world, goes stale when its entry is removed
+// (slot generation moves on), so it never aliases later registration reusing the slot
+template <typename T>
+struct WorldKey {
+    static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+    uint32_t index = INVALID_INDEX;     // slot
+    uint32_t generation = 0;
+
+    bool valid() const { return index != INVALID_INDEX; }
+    bool operator==(const WorldKey&) const = default;
+};
+
+using ForceId = WorldKey<forces::IForce>;
+using EnvironmentId = WorldKey<environment::IEnvironment>;
+
+// entries of one kind in registration order (environments depend on earlier ones); removed slots are reused,
+// live slots are linked in registration order and entries sharing a name are linked to each other, so add and
+// remove are O(1); names (static storage) map to first live entry of that name
+template <typename T>
+class WorldRegistry {
+public:
+    using Key = WorldKey<T>;
+
+    Key add(std::unique_ptr<T> item)
+    {
+        if (!item)
+        {
+            return {};
+        }
+
+        // reuse free slot or append one
+        uint32_t index = m_freeHead;
+        if (index != Key::INVALID_INDEX)
+        {
+            m_freeHead = m_slots[index].next;
+        }
+        else
+        {
+            index = static_cast<uint32_t>(m_slots.size());
+            m_slots.push_back({nullptr, 0, Key::INVALID_INDEX, Key::INVALID_INDEX, Key::INVALID_INDEX, Key::INVALID_INDEX, false});
+        }
+
+        Slot& slot = m_slots[index];
+
+        // append to registration order
+        slot.prev = m_tail;
+        slot.next = Key::INVALID_INDEX;
+        if (m_tail != Key::INVALID_INDEX)
+        {
+            m_slots[m_tail].next = index;
+        }
+        else
+        {
+            m_head = index;
+        }
+        m_tail = index;
+
+        // append to entries of same name
+        auto [it, inserted] = m_byName.try_emplace(item->getName(), Named{index, index});
+        slot.prevNamed = inserted ? Key::INVALID_INDEX : it->second.last;
+        slot.nextNamed = Key::INVALID_INDEX;
+        if (!inserted)
+        {
+            m_slots[it->second.last].nextNamed = index;
+            it->second.last = index;
+        }
+
+        slot.item = std::move(item);
+        slot.enabled = true;
+        m_size++;
+        return {index, slot.generation};
+    }
+
+    // false for stale key
+    bool remove(Key key)
+    {
+        if (!contains(key))
+        {
+            return false;
+        }
+
+        Slot& slot = m_slots[key.index];
+
+        // unlink from registration order
+        if (slot.prev != Key::INVALID_INDEX)
+        {
+            m_slots[slot.prev].next = slot.next;
+        }
+        else
+        {
+            m_head = slot.next;
+        }
+        if (slot.next != Key::INVALID_INDEX)
+        {
+            m_slots[slot.next].prev = slot.prev;
+        }
+        else
+        {
+            m_tail = slot.prev;
+        }
+
+        // unlink from entries of same name
+        auto it = m_byName.find(slot.item->getName());
+        Named named = it->second;
+        if (slot.nextNamed != Key::INVALID_INDEX)
+        {
+            m_slots[slot.nextNamed].prevNamed = slot.prevNamed;
+        }
+        else
+        {
+            named.last = slot.prevNamed;
+        }
+
+        if (slot.prevNamed != Key::INVALID_INDEX)
+        {
+            m_slots[slot.prevNamed].nextNamed = slot.nextNamed;
+            it->second = named;
+        }
+        else
+        {
+            named.first = slot.nextNamed;
+
+            // map key views name of first entry, next entry with same name takes over before this one goes away
+            m_byName.erase(it);
+            if (named.first != Key::INVALID_INDEX)
+            {
+                m_byName.emplace(m_slots[named.first].item->getName(), named);
+            }
+        }
+
+        release(key.index);
+        m_size--;
+        return true;
+    }
+
+    // outstanding keys go stale, slots are kept for reuse
+    void clear()
+    {
+        m_byName.clear();
+        for (uint32_t index = m_head; index != Key::INVALID_INDEX;)
+        {
+            const uint32_t next = m_slots[index].next;
+            release(index);
+            index = next;
+        }
+        m_head = Key::INVALID_INDEX;
+        m_tail = Key::INVALID_INDEX;
+        m_size = 0;
+    }
+
+    bool contains(Key key) const
+    {
+        return key.index < m_slots.size() && m_slots[key.index].generation == key.generation && m_slots[key.index].item;
+    }
+
+    // null for stale key
+    T* get(Key key) const { return contains(key) ? m_slots[key.index].item.get() : nullptr; }
+
+    Key keyOf(std::string_view name) const
+    {
+        auto it = m_byName.find(name);
+        return it != m_byName.end() ? Key{it->second.first, m_slots[it->second.first].generation} : Key{};
+    }
+
+    bool setEnabled(Key key, bool enabled)
+    {
+        if (!contains(key))
+        {
+            return false;
+        }
+        m_slots[key.index].enabled = enabled;
+        return true;
+    }
+
+    bool isEnabled(Key key) const { return contains(key) && m_slots[key.index].enabled; }
+
+    size_t size() const { return m_size; }
+
+    // live entries in registration order, fn(Key, T&)
+    template <typename Fn>
+    void forEach(Fn&& fn) const
+    {
+        for (uint32_t index = m_head; index != Key::INVALID_INDEX; index = m_slots[index].next)
+        {
+            fn(Key{index, m_slots[index].generation}, *m_slots[index].item);
+        }
+    }
+
+    // enabled entries in registration order, fn(T&)
+    template <typename Fn>
+    void forEachEnabled(Fn&& fn) const
+    {
+        for (uint32_t index = m_head; index != Key::INVALID_INDEX; index = m_slots[index].next)
+        {
+            const Slot& slot = m_slots[index];
+            if (slot.enabled)
+            {
+                fn(*slot.item);
+            }
+        }
+    }
+
+private:
+    struct Slot {
+        std::unique_ptr<T> item;
+        uint32_t generation;
+        uint32_t prev;              // previous live slot in registration order
+        uint32_t next;              // next live slot in registration order, next free slot while unused
+        uint32_t prevNamed;         // previous live slot with same name
+        uint32_t nextNamed;         // next live slot with same name
+        bool enabled;
+    };
+
+    // live entries of one name, in registration order
+    struct Named {
+        uint32_t first;
+        uint32_t last;
+    };
+
+    std::vector<Slot> m_slots;
+    std::unordered_map<std::string_view, Named> m_byName;
+    uint32_t m_head = Key::INVALID_INDEX;
+    uint32_t m_tail = Key::INVALID_INDEX;
+    uint32_t m_freeHead = Key::INVALID_INDEX;
+    size_t m_size = 0;
+
+    // free slots are chained through next
+    void release(uint32_t index)
+    {
+        Slot& slot = m_slots[index];
+        slot.item.reset();
+        slot.enabled = false;
+        slot.generation++;
+        slot.next = m_freeHead;
+        m_freeHead = index;
+    }
+};
+
 // physics world manages forces and environment
 class PhysicsWorld {
 public:
@@ -28,9 +270,19 @@ public:
     PhysicsWorld(PhysicsWorld&&) = default;
     PhysicsWorld& operator=(PhysicsWorld&&) = default;
 
-    // add force or environment
-    void addForce(std::unique_ptr<forces::IForce> force);
-    void addEnvironment(std::unique_ptr<environment::IEnvironment> environment);
+    // add force or environment, applied in order of addition; key stays valid until removal or clear (invalid for null)
+    ForceId addForce(std::unique_ptr<forces::IForce> force);
+    EnvironmentId addEnvironment(std::unique_ptr<environment::IEnvironment> environment);
+
+    // remove one, others keep their keys and order
+    bool removeForce(ForceId id) { return m_forces.remove(id); }
+    bool removeEnvironment(EnvironmentId id) { return m_environments.remove(id); }
+
+    // disabled entries stay registered but are skipped
+    bool setForceEnabled(ForceId id, bool enabled) { return m_forces.setEnabled(id, enabled); }
+    bool setEnvironmentEnabled(EnvironmentId id, bool enabled) { return m_environments.setEnabled(id, enabled); }
+    bool isForceEnabled(ForceId id) const { return m_forces.isEnabled(id); }
+    bool isEnvironmentEnabled(EnvironmentId id) const { return m_environments.isEnabled(id); }
 
     // remove all
     void clear();
@@ -38,22 +290,47 @@ public:
     // apply all forces to physics body
     void applyForces(IPhysicsBody& body, float dt);
 
-    // getters
-    forces::IForce* getForce(const std::string& name);
-    environment::IEnvironment* getEnvironment(const std::string& name);
+    // environments only, context at body state (for solvers evaluating forces themselves)
+    const PhysicsContext& updateContext(IPhysicsBody& body);
+
+    // floating origin: world position of local frame, environments add it to body positions
+    void setOrigin(const math::Vec3d& origin) { m_context.origin = origin; }
+    const math::Vec3d& getOrigin() const { return m_context.origin; }
 
-    const std::vector<std::unique_ptr<forces::IForce>>& getForces() const { return m_forces; }
-    const std::vector<std::unique_ptr<environment::IEnvironment>>& getEnvironments() const { return m_environments; }
+    // getters, by key or by name (hashed, first added of that name); null when not registered
+    forces::IForce* getForce(ForceId id) const { return m_forces.get(id); }
+    forces::IForce* getForce(std::string_view name) const { return m_forces.get(m_forces.keyOf(name)); }
+    environment::IEnvironment* getEnvironment(EnvironmentId id) const { return m_environments.get(id); }
+    environment::IEnvironment* getEnvironment(std::string_view name) const { return m_environments.get(m_environments.keyOf(name)); }
+
+    ForceId findForce(std::string_view name) const { return m_forces.keyOf(name); }
+    EnvironmentId findEnvironment(std::string_view name) const { return m_environments.keyOf(name); }
+
+    // registered entries in order, enabled or not (copies pointers, forEach variants below do not)
+    std::vector<forces::IForce*> getForces() const;
+    std::vector<environment::IEnvironment*> getEnvironments() const;
+
+    // registered entries in order, enabled or not: fn(key, entry)
+    template <typename Fn>
+    void forEachForce(Fn&& fn) const { m_forces.forEach(fn); }
+    template <typename Fn>
+    void forEachEnvironment(Fn&& fn) const { m_environments.forEach(fn); }
 
     // counts
     size_t forceCount() const { return m_forces.size(); }
     size_t environmentCount() const { return m_environments.size(); }
 
+    // instrumentation (fed only when built with BULLET_PHYSICS_PROFILING)
+    Profiler& getProfiler() { return m_profiler; }
+    const Profiler& getProfiler() const { return m_profiler; }
+
 private:
-    std::vector<std::unique_ptr<forces::IForce>> m_forces;
-    std::vector<std::unique_ptr<environment::IEnvironment>> m_environments;
+    WorldRegistry<forces::IForce> m_forces;
+    WorldRegistry<environment::IEnvironment> m_environments;
 
     PhysicsContext m_context;
+
+    Profiler m_profiler;
 };
 
 } // namespace dynamics
@@ -0,0 +1,240 @@
+/*
+ * Profiler.cpp
+ */
+
+#include "Profiler.h"
+
+#include <algorithm>
+#include <bit>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace BulletPhysics {
+namespace dynamics {
+
+namespace {
+
+const char* categoryName(ProfileCategory category)
+{
+    switch (category)
+    {
+    case ProfileCategory::Environment:
+        return "environment";
+    case ProfileCategory::Force:
+        return "force";
+    case ProfileCategory::Integrator:
+        return "integrator";
+    default:
+        return "unknown";
+    }
+}
+
+// escape string for JSON output
+std::string escape(std::string_view text)
+{
+    std::string out;
+    out.reserve(text.size());
+
+    for (char c : text)
+    {
+        switch (c)
+        {
+        case '"':
+            out += "\\\"";
+            break;
+        case '\\':
+            out += "\\\\";
+            break;
+        case '\n':
+            out += "\\n";
+            break;
+        case '\t':
+            out += "\\t";
+            break;
+        default:
+            out += c;
+        }
+    }
+
+    return out;
+}
+
+bool writeFile(const std::string& filename, const std::string& content)
+{
+    std::ofstream file(filename);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    file << content;
+    return file.good();
+}
+
+} // namespace
+
+void Profiler::record(ProfileCategory category, std::string_view name, Clock::time_point start, Clock::time_point end)
+{
+    const uint64_t durationNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+
+    // key string built only on first call of name
+    auto& stats = m_stats[static_cast<size_t>(category)];
+    auto it = stats.find(name);
+    if (it == stats.end())
+    {
+        it = stats.emplace(std::string(name), ProfileStats{}).first;
+    }
+    ProfileStats& entry = it->second;
+
+    entry.calls++;
+    entry.totalNs += durationNs;
+    entry.minNs = std::min(entry.minNs, durationNs);
+    entry.maxNs = std::max(entry.maxNs, durationNs);
+
+    // log2 bucket, zero durations land in first bucket
+    size_t bucket = durationNs > 0 ? static_cast<size_t>(std::bit_width(durationNs)) - 1 : 0;
+    entry.histogram[std::min(bucket, ProfileStats::HISTOGRAM_BUCKETS - 1)]++;
+
+    if (m_events.size() < m_traceCapacity)
+    {
+        const uint64_t startNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(start - m_epoch).count());
+        m_events.push_back({it->first, category, startNs, durationNs});
+    }
+    else if (m_traceCapacity > 0)
+    {
+        m_droppedEvents++;
+    }
+}
+
+void Profiler::countStage(std::string_view integrator)
+{
+    auto it = m_stageCounts.find(integrator);
+    if (it == m_stageCounts.end())
+    {
+        it = m_stageCounts.emplace(std::string(integrator), 0).first;
+    }
+    it->second++;
+}
+
+void Profiler::reset()
+{
+    // events point into stats keys, clear them first
+    m_events.clear();
+    m_droppedEvents = 0;
+
+    for (auto& stats : m_stats)
+    {
+        stats.clear();
+    }
+    m_stageCounts.clear();
+
+    m_epoch = Clock::now();
+}
+
+void Profiler::setTraceCapacity(size_t capacity)
+{
+    m_traceCapacity = capacity;
+
+    if (m_events.size() > capacity)
+    {
+        m_droppedEvents += m_events.size() - capacity;
+        m_events.resize(capacity);
+    }
+}
+
+const ProfileNameMap<ProfileStats>& Profiler::getStats(ProfileCategory category) const
+{
+    return m_stats[static_cast<size_t>(category)];
+}
+
+std::string Profiler::toJson() const
+{
+    std::ostringstream out;
+
+    out << "{\n";
+
+    const ProfileCategory categories[] = {ProfileCategory::Environment, ProfileCategory::Force};
+    for (ProfileCategory category : categories)
+    {
+        out << "  \"" << categoryName(category) << "\": {";
+
+        bool first = true;
+        for (const auto& [name, stats] : getStats(category))
+        {
+            out << (first ? "\n" : ",\n");
+            first = false;
+
+            out << "    \"" << escape(name) << "\": {"
+                << "\"calls\": " << stats.calls
+                << ", \"totalNs\": " << stats.totalNs
+                << ", \"minNs\": " << (stats.calls > 0 ? stats.minNs : 0)
+                << ", \"maxNs\": " << stats.maxNs
+                << ", \"histogramLog2Ns\": [";
+
+            for (size_t i = 0; i < stats.histogram.size(); i++)
+            {
+                out << (i > 0 ? ", " : "") << stats.histogram[i];
+            }
+
+            out << "]}";
+        }
+
+        out << (first ? "},\n" : "\n  },\n");
+    }
+
+    out << "  \"" << categoryName(ProfileCategory::Integrator) << "\": {";
+
+    bool first = true;
+    for (const auto& [name, count] : m_stageCounts)
+    {
+        out << (first ? "\n" : ",\n");
+        first = false;
+
+        out << "    \"" << escape(name) << "\": {\"stages\": " << count << "}";
+    }
+
+    out << (first ? "},\n" : "\n  },\n");
+    out << "  \"droppedEvents\": " << m_droppedEvents << "\n";
+    out << "}\n";
+
+    return out.str();
+}
+
+std::string Profiler::toChromeTrace() const
+{
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(3);
+
+    // complete events ("ph": "X"), timestamps in microseconds
+    out << "{\"traceEvents\": [";
+
+    for (size_t i = 0; i < m_events.size(); i++)
+    {
+        const ProfileEvent& event = m_events[i];
+
+        out << (i > 0 ? ",\n" : "\n")
+            << "  {\"name\": \"" << escape(event.name)
+            << "\", \"cat\": \"" << categoryName(event.category)
+            << "\", \"ph\": \"X\", \"pid\": 0, \"tid\": 0"
+            << ", \"ts\": " << static_cast<double>(event.startNs) * 1e-3
+            << ", \"dur\": " << static_cast<double>(event.durationNs) * 1e-3 << "}";
+    }
+
+    out << "\n], \"displayTimeUnit\": \"ns\"}\n";
+
+    return out.str();
+}
+
+bool Profiler::writeJson(const std::string& filename) const
+{
+    return writeFile(filename, toJson());
+}
+
+bool Profiler::writeChromeTrace(const std::string& filename) const
+{
+    return writeFile(filename, toChromeTrace());
+}
+
+} // namespace dynamics
+} // namespace BulletPhysics
@@ -0,0 +1,139 @@
+/*
+ * Profiler.h
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace BulletPhysics {
+namespace dynamics {
+
+// instrumented stage kinds
+enum class ProfileCategory {
+    Environment,    // IEnvironment::update
+    Force,          // IForce::apply
+    Integrator      // force evaluation stages of IIntegrator::step
+};
+
+// accumulated statistics of one instrumented name
+struct ProfileStats {
+    static constexpr size_t HISTOGRAM_BUCKETS = 32;     // bucket i holds durations in [2^i, 2^(i+1)) ns
+
+    uint64_t calls = 0;
+    uint64_t totalNs = 0;
+    uint64_t minNs = std::numeric_limits<uint64_t>::max();
+    uint64_t maxNs = 0;
+    std::array<uint64_t, HISTOGRAM_BUCKETS> histogram{};
+};
+
+// name-keyed map, looked up by string_view without building key string
+struct ProfileNameHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view name) const { return std::hash<std::string_view>{}(name); }
+};
+
+template <typename Value>
+using ProfileNameMap = std::unordered_map<std::string, Value, ProfileNameHash, std::equal_to<>>;
+
+// single timed event for trace export
+struct ProfileEvent {
+    std::string_view name;          // stats key
+    ProfileCategory category;
+    uint64_t startNs;       // relative to profiler epoch
+    uint64_t durationNs;
+};
+
+// collects call counts and timings of world stages, only fed when BULLET_PHYSICS_PROFILING is defined
+class Profiler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t DEFAULT_TRACE_CAPACITY = 1 << 16;
+
+    Profiler() = default;
+
+    // record one timed call
+    void record(ProfileCategory category, std::string_view name, Clock::time_point start, Clock::time_point end);
+
+    // count one force evaluation stage of named integrator
+    void countStage(std::string_view integrator);
+
+    // drop all statistics and trace events
+    void reset();
+
+    // maximum number of trace events kept (0 disables trace recording)
+    void setTraceCapacity(size_t capacity);
+    size_t getTraceCapacity() const { return m_traceCapacity; }
+    size_t getDroppedEvents() const { return m_droppedEvents; }
+
+    // getters
+    const ProfileNameMap<ProfileStats>& getStats(ProfileCategory category) const;
+    const ProfileNameMap<uint64_t>& getStageCounts() const { return m_stageCounts; }
+    const std::vector<ProfileEvent>& getEvents() const { return m_events; }
+
+    // export snapshot
+    std::string toJson() const;
+    std::string toChromeTrace() const;
+    bool writeJson(const std::string& filename) const;
+    bool writeChromeTrace(const std::string& filename) const;
+
+private:
+    std::array<ProfileNameMap<ProfileStats>, 3> m_stats;
+    ProfileNameMap<uint64_t> m_stageCounts;
+
+    std::vector<ProfileEvent> m_events;
+    size_t m_traceCapacity = DEFAULT_TRACE_CAPACITY;
+    size_t m_droppedEvents = 0;
+
+    Clock::time_point m_epoch = Clock::now();
+};
+
+// times enclosing scope and records it on destruction
+class ProfileScope {
+public:
+    ProfileScope(Profiler& profiler, ProfileCategory category, std::string_view name)
+        : m_profiler(profiler)
+        , m_category(category)
+        , m_name(name)
+        , m_start(Profiler::Clock::now())
+    {}
+
+    ~ProfileScope()
+    {
+        m_profiler.record(m_category, m_name, m_start, Profiler::Clock::now());
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    Profiler& m_profiler;
+    ProfileCategory m_category;
+    std::string_view m_name;
+    Profiler::Clock::time_point m_start;
+};
+
+} // namespace dynamics
+} // namespace BulletPhysics
+
+// instrumentation macros, expand to nothing unless profiling is enabled at compile time
+#define BULLET_PROFILE_CONCAT_IMPL(a, b) a##b
+#define BULLET_PROFILE_CONCAT(a, b) BULLET_PROFILE_CONCAT_IMPL(a, b)
+
+#ifdef BULLET_PHYSICS_PROFILING
+#define BULLET_PROFILE_SCOPE(profiler, category, name) \
+    ::BulletPhysics::dynamics::ProfileScope BULLET_PROFILE_CONCAT(profileScope_, __LINE__)((profiler), (category), (name))
+#define BULLET_PROFILE_STAGE(profiler, integrator) (profiler).countStage(integrator)
+#else
+// arguments stay unevaluated but count as used, so parameters passed only for profiling do not warn
+#define BULLET_PROFILE_SCOPE(profiler, category, name) ((void)sizeof((profiler), (category), (name)))
+#define BULLET_PROFILE_STAGE(profiler, integrator) ((void)sizeof((profiler), (integrator)))
+#endif
@@ -0,0 +1,203 @@
+/*
+ * ProjectileStore.cpp
+ */
+
+#include "ProjectileStore.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace BulletPhysics {
+namespace dynamics {
+namespace projectile {
+
+ProjectileSpecs ProjectileStore::resolveSpecs(const ProjectileSpecs& specs)
+{
+    ProjectileSpecs resolved = specs;
+
+    // BC bands ascending by velocity, so band order in specs does not make distinct loads
+    std::sort(resolved.ballisticCoefficients.begin(), resolved.ballisticCoefficients.end(),
+              [](const BallisticCoefficient& a, const BallisticCoefficient& b) { return a.minVelocity < b.minVelocity; });
+
+    if (!resolved.diameter)
+    {
+        return resolved;
+    }
+    const float d = *resolved.diameter;
+
+    // cross-sectional area: S = pi * d ^ 2 / 4
+    if (!resolved.area)
+    {
+        resolved.area = math::constants::PI * d * d * 0.25f;
+    }
+
+    // uniform cylinder approximation: Ix = 1/8 * m * d^2
+    if (resolved.spinSpecs && !resolved.spinSpecs->momentOfInertia)
+    {
+        resolved.spinSpecs->momentOfInertia = 0.125f * resolved.mass * d * d;
+    }
+
+    return resolved;
+}
+
+const ProjectileLoad& ProjectileStore::intern(const ProjectileSpecs& specs)
+{
+    ProjectileSpecs resolved = resolveSpecs(specs);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (const auto& load : m_loads)
+    {
+        if (load->specs == resolved)
+        {
+            return *load;
+        }
+    }
+
+    auto load = std::make_unique<ProjectileLoad>();
+    load->specs = std::move(resolved);
+    const ProjectileSpecs& s = load->specs;
+
+    load->mass = s.mass;
+
+    // area and caliber from each other
+    load->diameter = s.diameter.value_or(std::sqrt(4.0f * s.area.value_or(constants::DEFAULT_AREA) / math::constants::PI));
+    load->area = s.area.value_or(math::constants::PI * load->diameter * load->diameter * 0.25f);
+    load->axialInertia = 0.125f * s.mass * load->diameter * load->diameter;
+
+    load->liftCoefficient = constants::DEFAULT_C_L_ALPHA;
+    load->magnusCoefficient = constants::DEFAULT_C_MAG_F;
+    load->overturningCoefficient = constants::DEFAULT_C_M_ALPHA;
+    load->rollDampingCoefficient = constants::DEFAULT_C_SPIN;
+    load->rollDampingTable = nullptr;
+    load->spinSign = 1.0f;
+    load->spinning = false;
+
+    if (s.spinSpecs)
+    {
+        const SpinSpecs& spin = *s.spinSpecs;
+
+        load->axialInertia = spin.momentOfInertia.value_or(load->axialInertia);
+        load->liftCoefficient = spin.liftCoefficient;
+        load->magnusCoefficient = spin.magnusCoefficient;
+        load->overturningCoefficient = spin.overtuningCoefficient;
+        load->rollDampingCoefficient = spin.rollDampingCoefficient;
+        load->rollDampingTable = spin.rollDampingTable ? &*spin.rollDampingTable : nullptr;
+
+        // same requirement as Lift, Magnus and SpinDecay forces
+        load->spinning = s.diameter.has_value();
+        if (spin.riflingSpecs && spin.riflingSpecs->direction == RiflingSpecs::Direction::LEFT)
+        {
+            load->spinSign = -1.0f;
+        }
+    }
+
+    // BCs are G1 unless stated, custom curve comes from own file (without one, as if no model was stated)
+    const bool hasBC = !s.ballisticCoefficients.empty();
+    if (s.dragModel == forces::drag::DragCurveModel::CUSTOM && s.dragCurveFile)
+    {
+        load->dragModel = customDragModel(*s.dragCurveFile);
+    }
+    else
+    {
+        if (s.dragModel == forces::drag::DragCurveModel::CUSTOM)
+        {
+            std::cerr << "custom drag model without curve file, " << (hasBC ? "BCs refer to G1" : "using default drag") << std::endl;
+        }
+
+        const bool standard = s.dragModel && s.dragModel != forces::drag::DragCurveModel::CUSTOM;
+        load->dragModel = standard ? dragModel(*s.dragModel) : hasBC ? dragModel(forces::drag::DragCurveModel::G1) : nullptr;
+    }
+    load->dragTable = buildDragTable(*load);
+
+    // table holds first band, others scale it
+    if (load->dragModel && s.ballisticCoefficients.size() > 1)
+    {
+        for (const BallisticCoefficient& band : s.ballisticCoefficients)
+        {
+            load->dragBands.push_back({band.minVelocity, s.ballisticCoefficients.front().value / band.value});
+        }
+    }
+
+    if (s.reynoldsDragFile)
+    {
+        const forces::drag::ReynoldsDragModel* model = reynoldsDragModel(*s.reynoldsDragFile);
+        load->reynoldsDragTable = model->getTable().scaled(s.formFactor.value_or(1.0f) * load->area);
+    }
+
+    m_loads.push_back(std::move(load));
+    return *m_loads.back();
+}
+
+forces::drag::DragTable ProjectileStore::buildDragTable(const ProjectileLoad& load)
+{
+    const ProjectileSpecs& s = load.specs;
+    const forces::drag::IDragModel* curve = load.dragModel;
+
+    if (!s.ballisticCoefficients.empty() && curve)
+    {
+        // i = SD / BC and S = pi * d^2 / 4 give C_d * S = C_d_standard * pi * m / (4 * BC), caliber drops out;
+        // bands are by velocity, not Mach, so only lowest is folded in and load's drag bands scale it at run time
+        const float bc = s.ballisticCoefficients.front().value * constants::LB_PER_IN2_TO_KG_PER_M2;
+        return forces::drag::DragTable::sample([&](float mach) { return curve->getCd(mach) * math::constants::PI * s.mass / (4.0f * bc); });
+    }
+
+    const float scale = s.formFactor.value_or(1.0f) * load.area;
+    if (!curve)
+    {
+        return forces::drag::DragTable::constant(constants::DEFAULT_CD * scale);
+    }
+    return forces::drag::DragTable::sample([&](float mach) { return curve->getCd(mach) * scale; });
+}
+
+size_t ProjectileStore::size() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_loads.size();
+}
+
+ProjectileStore& ProjectileStore::shared()
+{
+    static ProjectileStore store;
+    return store;
+}
+
+const forces::drag::IDragModel* ProjectileStore::dragModel(forces::drag::DragCurveModel model)
+{
+    const size_t index = static_cast<size_t>(model);
+    if (index >= m_dragModels.size())
+    {
+        return nullptr;
+    }
+
+    if (!m_dragModels[index])
+    {
+        m_dragModels[index] = std::make_unique<forces::drag::StandardDragModel>(model);
+    }
+    return m_dragModels[index].get();
+}
+
+const forces::drag::IDragModel* ProjectileStore::customDragModel(const std::string& filename)
+{
+    auto& model = m_customDragModels[filename];
+    if (!model)
+    {
+        model = std::make_unique<forces::drag::CustomCurveDragModel>(filename);
+    }
+    return model.get();
+}
+
+const forces::drag::ReynoldsDragModel* ProjectileStore::reynoldsDragModel(const std::string& filename)
+{
+    auto& model = m_reynoldsDragModels[filename];
+    if (!model)
+    {
+        model = std::make_unique<forces::drag::ReynoldsDragModel>(filename);
+    }
+    return model.get();
+}
+
+} // namespace projectile
+} // namespace dynamics
+} // namespace BulletPhysics
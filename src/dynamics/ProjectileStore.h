@@ -0,0 +1,117 @@
+/*
+ * ProjectileStore.h
+ */
+
+#pragma once
+
+#include "PhysicsBody.h"
+#include "forces/drag/DragModel.h"
+#include "forces/drag/DragTable.h"
+#include "forces/drag/MachReynoldsTable.h"
+
+#include <array>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace BulletPhysics {
+namespace dynamics {
+namespace projectile {
+
+// BC band of load: drag table factor from minVelocity up to next band
+struct DragBand {
+    float minVelocity;              // m/s
+    float scale;                    // first band's BC over this band's BC
+};
+
+// interned projectile load: specs plus constants resolved once, so force code reads plain fields
+struct ProjectileLoad {
+    ProjectileSpecs specs;          // area and I_x filled in when caliber is known
+
+    float mass;                     // kg
+    float area;                     // m^2
+    float diameter;                 // m, from area when only area is given
+    float axialInertia;             // I_x (kg * m^2)
+
+    float liftCoefficient;          // C_L_alpha
+    float magnusCoefficient;        // C_mag_f
+    float overturningCoefficient;   // C_M_alpha
+    float rollDampingCoefficient;   // C_spin
+    const MachTable* rollDampingTable;      // C_spin by Mach, points into specs, null uses constant
+
+    float spinSign;                 // +1 right twist, -1 left
+    bool spinning;                  // spin specs and caliber present, enables lift, Magnus and spin decay
+
+    const forces::drag::IDragModel* dragModel;      // standard curve, owned by store, null uses DEFAULT_CD
+    forces::drag::DragTable dragTable;              // C_d * S (m^2) by Mach, form factor or (first) BC folded in
+    std::vector<DragBand> dragBands;                // ascending, only for loads with several BC bands
+    forces::drag::MachReynoldsTable reynoldsDragTable;      // C_d * S (m^2) by Mach and Re, form factor folded in, empty for Mach-only drag
+
+    float rollDampingAt(float mach) const { return rollDampingTable ? rollDampingTable->at(mach) : rollDampingCoefficient; }
+
+    // BC band by air speed itself, published bands are velocities and Mach of same speed moves with temperature
+    float dragScaleAt(float speed) const
+    {
+        float scale = 1.0f;
+        for (const DragBand& band : dragBands)
+        {
+            if (band.minVelocity > speed)
+            {
+                break;
+            }
+            scale = band.scale;
+        }
+        return scale;
+    }
+
+    // drag force is -1/2 * rho * dragAreaAt(mach, |v|) * |v| * v
+    float dragAreaAt(float mach, float speed) const { return dragTable.at(mach) * dragScaleAt(speed); }
+
+    // Re = rho * |v| * d / mu needed only when drag depends on it
+    bool reynoldsDependent() const { return !reynoldsDragTable.empty(); }
+    float dragAreaAt(float mach, float speed, float reynolds) const { return reynoldsDependent() ? reynoldsDragTable.at(mach, reynolds) : dragAreaAt(mach, speed); }
+};
+
+// set of distinct loads, equal specs give same load; loads are never removed and keep their address,
+// interning is thread-safe, reading a load needs no lock
+class ProjectileStore {
+public:
+    ProjectileStore() = default;
+    ProjectileStore(const ProjectileStore&) = delete;
+    ProjectileStore& operator=(const ProjectileStore&) = delete;
+
+    const ProjectileLoad& intern(const ProjectileSpecs& specs);
+
+    size_t size() const;
+
+    // store behind bodies constructed from plain specs
+    static ProjectileStore& shared();
+
+private:
+    mutable std::mutex m_mutex;
+
+    // few loads per scene (tens), linear lookup on intern only
+    std::vector<std::unique_ptr<ProjectileLoad>> m_loads;
+
+    // standard curves loaded on first use
+    std::array<std::unique_ptr<forces::drag::StandardDragModel>, static_cast<size_t>(forces::drag::DragCurveModel::CUSTOM)> m_dragModels;
+
+    // custom curves by file, fitted (or read from cache) on first use
+    std::map<std::string, std::unique_ptr<forces::drag::CustomCurveDragModel>> m_customDragModels;
+
+    const forces::drag::IDragModel* dragModel(forces::drag::DragCurveModel model);
+    const forces::drag::IDragModel* customDragModel(const std::string& filename);
+
+    // Mach and Reynolds tables by file, loaded on first use
+    std::map<std::string, std::unique_ptr<forces::drag::ReynoldsDragModel>> m_reynoldsDragModels;
+
+    const forces::drag::ReynoldsDragModel* reynoldsDragModel(const std::string& filename);
+
+    static ProjectileSpecs resolveSpecs(const ProjectileSpecs& specs);
+    static forces::drag::DragTable buildDragTable(const ProjectileLoad& load);
+};
+
+} // namespace projectile
+} // namespace dynamics
+} // namespace BulletPhysics
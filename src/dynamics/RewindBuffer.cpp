@@ -0,0 +1,332 @@
+/*
+ * RewindBuffer.cpp
+ */
+
+#include "RewindBuffer.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+
+namespace BulletPhysics {
+namespace dynamics {
+
+namespace {
+
+// delta stream: record count, then per record its key and mask of changed fields followed by those fields,
+// NEW_RECORD mask carries whole record (spawned body, new generation or collider missing from base)
+constexpr uint8_t NEW_RECORD = 0x80;
+
+struct Field {
+    size_t offset;
+    size_t size;
+};
+
+constexpr Field BODY_FIELDS[] = {
+    {offsetof(BodyRecord, position), sizeof(math::Vec3)},
+    {offsetof(BodyRecord, velocity), sizeof(math::Vec3)},
+    {offsetof(BodyRecord, orientation), sizeof(math::Quat)},
+    {offsetof(BodyRecord, angularVelocity), sizeof(math::Vec3)},
+    {offsetof(BodyRecord, spinRate), sizeof(float)}
+};
+
+constexpr Field COLLIDER_FIELDS[] = {
+    {offsetof(ColliderRecord, radius), sizeof(float)},
+    {offsetof(ColliderRecord, position), sizeof(math::Vec3)},
+    {offsetof(ColliderRecord, axisX), sizeof(math::Vec3)},
+    {offsetof(ColliderRecord, axisY), sizeof(math::Vec3)}
+};
+
+uint64_t keyOf(const BodyRecord& record) { return record.key; }
+uint32_t keyOf(const ColliderRecord& record) { return record.id; }
+
+// same body needs same generation, otherwise slot was reused
+bool sameEntity(const BodyRecord& a, const BodyRecord& b) { return a.generation == b.generation; }
+bool sameEntity(const ColliderRecord&, const ColliderRecord&) { return true; }
+
+bool sameOrigin(const math::Vec3d& a, const math::Vec3d& b) { return a.x == b.x && a.y == b.y && a.z == b.z; }
+
+void write(std::vector<uint8_t>& out, const void* data, size_t size)
+{
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    out.insert(out.end(), bytes, bytes + size);
+}
+
+void read(const uint8_t*& in, void* data, size_t size)
+{
+    std::memcpy(data, in, size);
+    in += size;
+}
+
+// both sequences sorted by key
+template <typename Record, size_t FieldCount>
+void encodeRecords(const std::vector<Record>& base, const std::vector<Record>& records, const Field (&fields)[FieldCount], std::vector<uint8_t>& out)
+{
+    const uint32_t count = static_cast<uint32_t>(records.size());
+    write(out, &count, sizeof(count));
+
+    auto b = base.begin();
+    for (const Record& record : records)
+    {
+        const auto key = keyOf(record);
+        while (b != base.end() && keyOf(*b) < key)
+        {
+            ++b;
+        }
+
+        write(out, &key, sizeof(key));
+
+        if (b == base.end() || keyOf(*b) != key || !sameEntity(*b, record))
+        {
+            write(out, &NEW_RECORD, 1);
+            write(out, &record, sizeof(Record));
+            continue;
+        }
+
+        const auto* now = reinterpret_cast<const uint8_t*>(&record);
+        const auto* before = reinterpret_cast<const uint8_t*>(&*b);
+
+        uint8_t mask = 0;
+        for (size_t f = 0; f < FieldCount; f++)
+        {
+            if (std::memcmp(now + fields[f].offset, before + fields[f].offset, fields[f].size) != 0)
+            {
+                mask |= static_cast<uint8_t>(1u << f);
+            }
+        }
+
+        write(out, &mask, 1);
+        for (size_t f = 0; f < FieldCount; f++)
+        {
+            if (mask & (1u << f))
+            {
+                write(out, now + fields[f].offset, fields[f].size);
+            }
+        }
+    }
+}
+
+template <typename Record, size_t FieldCount>
+void decodeRecords(const std::vector<Record>& base, const uint8_t*& in, const Field (&fields)[FieldCount], std::vector<Record>& out)
+{
+    uint32_t count;
+    read(in, &count, sizeof(count));
+    out.resize(count);
+
+    auto b = base.begin();
+    for (Record& record : out)
+    {
+        decltype(keyOf(record)) key;
+        uint8_t mask;
+        read(in, &key, sizeof(key));
+        read(in, &mask, 1);
+
+        if (mask == NEW_RECORD)
+        {
+            read(in, &record, sizeof(Record));
+            continue;
+        }
+
+        while (keyOf(*b) < key)
+        {
+            ++b;
+        }
+        record = *b;
+
+        auto* bytes = reinterpret_cast<uint8_t*>(&record);
+        for (size_t f = 0; f < FieldCount; f++)
+        {
+            if (mask & (1u << f))
+            {
+                read(in, bytes + fields[f].offset, fields[f].size);
+            }
+        }
+    }
+}
+
+// distance from point to segment
+float segmentDistance(const math::Vec3& point, const math::Vec3& start, const math::Vec3& end)
+{
+    const math::Vec3 delta = end - start;
+    const float lengthSq = delta.dot(delta);
+    const float t = lengthSq > 0.0f ? std::clamp((point - start).dot(delta) / lengthSq, 0.0f, 1.0f) : 0.0f;
+    return (point - (start + delta * t)).length();
+}
+
+} // namespace
+
+RewindBuffer::RewindBuffer(size_t ticks) : m_frames(std::max<size_t>(ticks, 1) + KEYFRAME_INTERVAL - 1), m_ticks(std::max<size_t>(ticks, 1)) {}
+
+void RewindBuffer::encode(const Snapshot& base, const Snapshot& snapshot, std::vector<uint8_t>& out)
+{
+    out.clear();
+    encodeRecords(base.bodies, snapshot.bodies, BODY_FIELDS, out);
+    encodeRecords(base.colliders, snapshot.colliders, COLLIDER_FIELDS, out);
+}
+
+void RewindBuffer::decode(const Snapshot& base, const std::vector<uint8_t>& delta, uint64_t tick, Snapshot& out)
+{
+    const uint8_t* in = delta.data();
+    out.tick = tick;
+    out.origin = base.origin;
+    decodeRecords(base.bodies, in, BODY_FIELDS, out.bodies);
+    decodeRecords(base.colliders, in, COLLIDER_FIELDS, out.colliders);
+}
+
+void RewindBuffer::push(const Snapshot& snapshot)
+{
+    const bool consecutive = m_hasPrevious && snapshot.tick == m_previous.tick + 1;
+
+    Frame& target = frame(snapshot.tick);
+    target.tick = snapshot.tick;
+    target.valid = true;
+    // deltas share origin of their base, rebase moves every position anyway
+    target.keyframe = !consecutive || snapshot.tick % KEYFRAME_INTERVAL == 0 || !sameOrigin(snapshot.origin, m_previous.origin);
+
+    if (target.keyframe)
+    {
+        target.full = snapshot;
+        target.delta.clear();
+
+        // older ticks do not chain into new keyframe after gap or rewind
+        if (!consecutive)
+        {
+            for (Frame& other : m_frames)
+            {
+                other.valid = &other == &target;
+            }
+        }
+    }
+    else
+    {
+        encode(m_previous, snapshot, target.delta);
+        target.full.bodies.clear();
+        target.full.colliders.clear();
+    }
+
+    m_previous = snapshot;
+    m_hasPrevious = true;
+    // cached decode is stale after rollback or gap (pushed tick may be cached one re-simulated) and once its frame is reused
+    m_hasDecoded = m_hasDecoded && consecutive && &frame(m_decoded.tick) != &target && contains(m_decoded.tick);
+}
+
+bool RewindBuffer::contains(uint64_t tick) const
+{
+    if (!m_hasPrevious || tick > m_previous.tick || m_previous.tick - tick >= m_ticks)
+    {
+        return false;
+    }
+
+    const Frame& target = frame(tick);
+    return target.valid && target.tick == tick;
+}
+
+const Snapshot* RewindBuffer::decodeTick(uint64_t tick)
+{
+    if (!contains(tick))
+    {
+        return nullptr;
+    }
+
+    if (!m_hasDecoded || m_decoded.tick != tick)
+    {
+        // nearest keyframe at or before tick, cached decode is reused when it lies in between
+        uint64_t key = tick;
+        while (!frame(key).keyframe && !(m_hasDecoded && m_decoded.tick == key))
+        {
+            key--;
+        }
+
+        if (!(m_hasDecoded && m_decoded.tick == key))
+        {
+            m_decoded = frame(key).full;
+        }
+
+        for (uint64_t t = key + 1; t <= tick; t++)
+        {
+            decode(m_decoded, frame(t).delta, t, m_scratch);
+            std::swap(m_decoded, m_scratch);
+        }
+        m_hasDecoded = true;
+    }
+
+    return &m_decoded;
+}
+
+bool RewindBuffer::get(uint64_t tick, Snapshot& outSnapshot)
+{
+    const Snapshot* snapshot = decodeTick(tick);
+    if (!snapshot)
+    {
+        return false;
+    }
+
+    outSnapshot = *snapshot;
+    return true;
+}
+
+bool RewindBuffer::sweepAt(uint64_t tick, collision::CollisionDetection& detection, const math::Vec3d& origin, const math::Vec3& start,
+                           const math::Vec3& end, float radius, collision::SweepHit& outHit)
+{
+    const Snapshot* snapshot = decodeTick(tick);
+    if (!snapshot)
+    {
+        return false;
+    }
+
+    const math::Vec3 shift(snapshot->origin - origin);
+
+    bool hit = false;
+    outHit.info.time = std::numeric_limits<float>::infinity();
+
+    for (const ColliderRecord& record : snapshot->colliders)
+    {
+        collision::Collider* collider = detection.getCollider(record.id);
+        if (!collider || segmentDistance(record.position + shift, start, end) > record.radius + radius)
+        {
+            continue;
+        }
+
+        ColliderRecord live;
+        readColliderPose(*collider, live);
+        ColliderRecord past = record;
+        past.position += shift;
+        writeColliderPose(*collider, past);
+
+        collision::SweepInfo info;
+        if (collider->testSweptSphere(start, end, radius, info) && info.time < outHit.info.time)
+        {
+            hit = true;
+            outHit.collider = collider;
+            outHit.info = info;
+        }
+
+        writeColliderPose(*collider, live);
+    }
+
+    return hit;
+}
+
+size_t RewindBuffer::memoryBytes() const
+{
+    size_t bytes = 0;
+    for (const Frame& f : m_frames)
+    {
+        bytes += f.full.bodies.size() * sizeof(BodyRecord) + f.full.colliders.size() * sizeof(ColliderRecord) + f.delta.size();
+    }
+    return bytes;
+}
+
+void RewindBuffer::clear()
+{
+    for (Frame& f : m_frames)
+    {
+        f.valid = false;
+    }
+    m_hasPrevious = false;
+    m_hasDecoded = false;
+}
+
+} // namespace dynamics
+} // namespace BulletPhysics
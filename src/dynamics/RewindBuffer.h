@@ -0,0 +1,78 @@
+/*
+ * RewindBuffer.h
+ */
+
+#pragma once
+
+#include "Snapshot.h"
+#include "collision/CollisionDetection.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace BulletPhysics {
+namespace dynamics {
+
+// snapshots of last N ticks for lag compensation: keyframe every KEYFRAME_INTERVAL ticks,
+// ticks between keep only fields that changed since previous tick
+class RewindBuffer {
+public:
+    static constexpr uint64_t KEYFRAME_INTERVAL = 8;
+
+    explicit RewindBuffer(size_t ticks);
+
+    // store snapshot of next tick, gap or rewind in tick numbers or moved origin starts with keyframe
+    void push(const Snapshot& snapshot);
+
+    bool contains(uint64_t tick) const;
+    bool empty() const { return !m_hasPrevious; }
+    uint64_t latestTick() const { return m_previous.tick; }
+
+    // rebuild tick, last decoded tick is cached so repeated queries of one tick decode once
+    bool get(uint64_t tick, Snapshot& outSnapshot);
+
+    // earliest hit of sphere moving from start to end against colliders as they were at tick, without restoring
+    // whole world: only colliders whose recorded bounding sphere the sweep touches are moved back for their test,
+    // then returned to live pose; colliders added after tick are ignored; start and end are local to current world
+    // origin, records of tick are moved into it when floating origin moved since
+    bool sweepAt(uint64_t tick, collision::CollisionDetection& detection, const math::Vec3d& origin, const math::Vec3& start, const math::Vec3& end,
+                 float radius, collision::SweepHit& outHit);
+
+    // encoded bytes held (keyframe records and deltas)
+    size_t memoryBytes() const;
+
+    void clear();
+
+private:
+    struct Frame {
+        uint64_t tick = 0;
+        bool valid = false;
+        bool keyframe = false;
+        Snapshot full;                  // keyframes
+        std::vector<uint8_t> delta;     // other ticks, against previous tick
+    };
+
+    std::vector<Frame> m_frames;        // ring indexed by tick % size, sized so every kept tick reaches its keyframe
+    size_t m_ticks;
+
+    Snapshot m_previous;                // last pushed, base of next delta
+    bool m_hasPrevious = false;
+
+    Snapshot m_decoded;
+    bool m_hasDecoded = false;
+
+    Snapshot m_scratch;
+
+    // rebuilt tick in m_decoded, null when not kept
+    const Snapshot* decodeTick(uint64_t tick);
+
+    Frame& frame(uint64_t tick) { return m_frames[tick % m_frames.size()]; }
+    const Frame& frame(uint64_t tick) const { return m_frames[tick % m_frames.size()]; }
+
+    static void encode(const Snapshot& base, const Snapshot& snapshot, std::vector<uint8_t>& out);
+    static void decode(const Snapshot& base, const std::vector<uint8_t>& delta, uint64_t tick, Snapshot& out);
+};
+
+} // namespace dynamics
+} // namespace BulletPhysics
@@ -0,0 +1,210 @@
+/*
+ * Simulation.cpp
+ */
+
+#include "Simulation.h"
+#include "collision/CollisionDetection.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace BulletPhysics {
+namespace dynamics {
+
+namespace {
+
+math::Quat orientationOf(IPhysicsBody& body)
+{
+    const IRotationalBody* rotational = body.getRotational();
+    return rotational ? rotational->getOrientation() : math::Quat{};
+}
+
+// normalized lerp along shorter arc
+math::Quat blend(const math::Quat& a, const math::Quat& b, float t)
+{
+    const float dot = a.w * b.w + a.x * b.x + a.y * b.y + a.z * b.z;
+    const math::Quat target = dot < 0.0f ? b * -1.0f : b;
+    return (a * (1.0f - t) + target * t).normalized();
+}
+
+} // namespace
+
+Simulation::Simulation(float tickDt, std::unique_ptr<math::IIntegrator> integrator, collision::CollisionDetection* detection)
+    : m_integrator(std::move(integrator)), m_detection(detection), m_tickDt(DEFAULT_TICK), m_previous(DefaultBodyPool::typeCount())
+{
+    setTickDt(tickDt);
+}
+
+const FrameStats& Simulation::advance(float frameSeconds)
+{
+    m_frameStats = FrameStats{};
+    m_accumulator += std::max(frameSeconds, 0.0f);
+
+    uint64_t due = static_cast<uint64_t>(m_accumulator / m_tickDt);
+    if (due > m_maxSubsteps)
+    {
+        m_frameStats.droppedTicks = static_cast<uint32_t>(std::min<uint64_t>(due - m_maxSubsteps, UINT32_MAX));
+        m_accumulator -= static_cast<double>(due - m_maxSubsteps) * m_tickDt;
+        due = m_maxSubsteps;
+    }
+
+    for (uint64_t i = 0; i < due; i++)
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        // only last tick of frame is blended from
+        step(i + 1 == due);
+        m_accumulator -= m_tickDt;
+
+        const uint64_t ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+        m_frameStats.tickNs += ns;
+        m_frameStats.maxTickNs = std::max(m_frameStats.maxTickNs, ns);
+    }
+
+    m_frameStats.substeps = static_cast<uint32_t>(due);
+    m_frameStats.alpha = static_cast<float>(std::clamp(m_accumulator / m_tickDt, 0.0, 1.0));
+    m_frameStats.bodies = m_bodies.size();
+
+    buildRenderStates(m_frameStats.alpha);
+    return m_frameStats;
+}
+
+void Simulation::tick()
+{
+    step(true);
+}
+
+void Simulation::step(bool keepPrevious)
+{
+    m_bodies.forEachStorage([&](auto& storage, size_t type)
+    {
+        std::vector<PreviousState>& previous = m_previous[type];
+
+        for (size_t i = 0; i < storage.size(); i++)
+        {
+            auto& body = storage.at(i);
+
+            if (keepPrevious)
+            {
+                const auto handle = storage.handleAt(i);
+                if (handle.index >= previous.size())
+                {
+                    previous.resize(handle.index + 1);
+                }
+                previous[handle.index] = {body.getPosition(), orientationOf(body), handle.generation, true};
+            }
+
+            m_integrator->step(body, &m_world, m_tickDt);
+        }
+    });
+
+    m_tick++;
+
+    if (m_tickCallback)
+    {
+        m_tickCallback(*this, m_tickDt);
+    }
+
+    if (m_floatingOrigin)
+    {
+        updateOrigin();
+    }
+}
+
+void Simulation::setFloatingOrigin(bool enabled, float rebaseDistance)
+{
+    m_floatingOrigin = enabled;
+    m_rebaseDistance = std::max(rebaseDistance, 1.0f);
+}
+
+void Simulation::updateOrigin()
+{
+    math::Vec3 focus;
+    if (!m_originFocus || !m_originFocus(focus))
+    {
+        if (m_bodies.size() == 0)
+        {
+            return;
+        }
+
+        math::Vec3d sum;
+        m_bodies.forEach([&sum](IPhysicsBody& body) { sum += math::Vec3d(body.getPosition()); });
+        focus = math::Vec3(sum * (1.0 / static_cast<double>(m_bodies.size())));
+    }
+
+    if (focus.length() > m_rebaseDistance)
+    {
+        rebase(toWorld(focus));
+    }
+}
+
+void Simulation::rebase(const math::Vec3d& origin)
+{
+    // whole metres keep shift exact in float and its subtraction exact for bodies near new origin
+    const math::Vec3d snapped(std::round(origin.x), std::round(origin.y), std::round(origin.z));
+    const math::Vec3 shift(snapped - getOrigin());
+    if (shift.x == 0.0f && shift.y == 0.0f && shift.z == 0.0f)
+    {
+        return;
+    }
+
+    m_world.setOrigin(snapped);
+
+    m_bodies.forEach([&shift](IPhysicsBody& body) { body.setPosition(body.getPosition() - shift); });
+    for (std::vector<PreviousState>& previous : m_previous)
+    {
+        for (PreviousState& state : previous)
+        {
+            state.position -= shift;
+        }
+    }
+
+    if (m_detection)
+    {
+        m_detection->shiftOrigin(shift);
+    }
+
+    m_rebases++;
+    m_frameStats.rebases++;
+
+    if (m_rebaseCallback)
+    {
+        m_rebaseCallback(*this, shift);
+    }
+}
+
+// bodies spawned after last tick have no previous state and are shown as they are
+void Simulation::buildRenderStates(float alpha)
+{
+    m_renderStates.clear();
+    m_renderStates.reserve(m_bodies.size());
+
+    m_bodies.forEachStorage([&](auto& storage, size_t type)
+    {
+        const std::vector<PreviousState>& previous = m_previous[type];
+
+        for (size_t i = 0; i < storage.size(); i++)
+        {
+            auto& body = storage.at(i);
+            const auto handle = storage.handleAt(i);
+
+            RenderState state{body.getPosition(), body.getVelocity(), orientationOf(body), static_cast<uint32_t>(type), handle.index};
+
+            if (handle.index < previous.size())
+            {
+                const PreviousState& before = previous[handle.index];
+                if (before.valid && before.generation == handle.generation)
+                {
+                    state.position = before.position + (state.position - before.position) * alpha;
+                    state.orientation = blend(before.orientation, state.orientation, alpha);
+                }
+            }
+
+            m_renderStates.push_back(state);
+        }
+    });
+}
+
+} // namespace dynamics
+} // namespace BulletPhysics
@@ -0,0 +1,172 @@
+/*
+ * Simulation.h
+ */
+
+#pragma once
+
+#include "BodyPool.h"
+#include "PhysicsWorld.h"
+#include "math/Integrator.h"
+#include "math/Quat.h"
+#include "math/Vec3.h"
+
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace BulletPhysics {
+namespace collision {
+
+class CollisionDetection;
+
+} // namespace collision
+
+namespace dynamics {
+
+// body state blended between last two ticks for rendering
+struct RenderState {
+    math::Vec3 position;
+    math::Vec3 velocity;        // at latest tick
+    math::Quat orientation;     // identity for point-mass bodies
+    uint32_t type;              // body type index in DefaultBodyPool
+    uint32_t slot;              // handle index, stable while body lives
+};
+
+// what one advance() call did
+struct FrameStats {
+    uint32_t substeps = 0;          // ticks run
+    uint32_t droppedTicks = 0;      // ticks discarded by substep clamp
+    float alpha = 0.0f;             // blend factor between previous and current tick
+    uint64_t tickNs = 0;            // wall time of all ticks
+    uint64_t maxTickNs = 0;         // slowest tick
+    uint32_t rebases = 0;           // floating origin moves
+    size_t bodies = 0;
+};
+
+// fixed-timestep driver: owns world, bodies and integrator, turns variable frame time into whole ticks
+// and blends last two ticks for rendering;
+// with floating origin body positions are float offsets from double world origin, which moves (on whole metres)
+// to focus body, or bodies' centroid without one, once it strays beyond rebase distance
+class Simulation {
+public:
+    using TickCallback = std::function<void(Simulation&, float dt)>;
+    using RebaseCallback = std::function<void(Simulation&, const math::Vec3& shift)>;
+
+    static constexpr float DEFAULT_TICK = 1.0f / 120.0f;
+    static constexpr uint32_t DEFAULT_MAX_SUBSTEPS = 8;
+    static constexpr float DEFAULT_REBASE_DISTANCE = 2048.0f;   // m, float spacing there is 0.25 mm
+
+    // colliders of detection (optional, caller-owned) share local frame with bodies and move with them on rebase
+    explicit Simulation(float tickDt = DEFAULT_TICK, std::unique_ptr<math::IIntegrator> integrator = std::make_unique<math::RK4Integrator>(),
+                        collision::CollisionDetection* detection = nullptr);
+
+    Simulation(const Simulation&) = delete;
+    Simulation& operator=(const Simulation&) = delete;
+
+    // world and bodies
+    PhysicsWorld& getWorld() { return m_world; }
+    DefaultBodyPool& getBodies() { return m_bodies; }
+
+    template <typename Body, typename... Args>
+    BodyHandle<Body> spawn(Args&&... args) { return m_bodies.spawn<Body>(std::forward<Args>(args)...); }
+
+    template <typename Body>
+    bool despawn(BodyHandle<Body> handle) { return m_bodies.despawn(handle); }
+
+    // run due ticks for frame time, clamped to max substeps (excess time is dropped to avoid spiral of death)
+    const FrameStats& advance(float frameSeconds);
+
+    // single tick regardless of accumulator
+    void tick();
+
+    // called after every tick, may spawn and despawn bodies
+    void setTickCallback(TickCallback callback) { m_tickCallback = std::move(callback); }
+
+    // floating origin, checked after every tick
+    void setFloatingOrigin(bool enabled, float rebaseDistance = DEFAULT_REBASE_DISTANCE);
+    bool isFloatingOrigin() const { return m_floatingOrigin; }
+    float getRebaseDistance() const { return m_rebaseDistance; }
+    uint32_t getRebaseCount() const { return m_rebases; }
+
+    template <typename Body>
+    void setOriginFocus(BodyHandle<Body> handle)
+    {
+        m_originFocus = [this, handle](math::Vec3& outPosition)
+        {
+            const Body* body = m_bodies.get(handle);
+            if (body)
+            {
+                outPosition = body->getPosition();
+            }
+            return body != nullptr;
+        };
+    }
+    void clearOriginFocus() { m_originFocus = nullptr; }
+
+    // move origin now (snapped to whole metres), shifts bodies, interpolation state and colliders of attached detection,
+    // then calls rebase callback which should shift other user state kept in local frame (camera)
+    void rebase(const math::Vec3d& origin);
+    void setRebaseCallback(RebaseCallback callback) { m_rebaseCallback = std::move(callback); }
+
+    // detection whose colliders move with rebase, null to detach
+    void setCollisionDetection(collision::CollisionDetection* detection) { m_detection = detection; }
+    collision::CollisionDetection* getCollisionDetection() const { return m_detection; }
+
+    const math::Vec3d& getOrigin() const { return m_world.getOrigin(); }
+    math::Vec3d toWorld(const math::Vec3& local) const { return getOrigin() + math::Vec3d(local); }
+    math::Vec3 toLocal(const math::Vec3d& world) const { return math::Vec3(world - getOrigin()); }
+
+    void setMaxSubsteps(uint32_t maxSubsteps) { m_maxSubsteps = maxSubsteps > 0 ? maxSubsteps : 1; }
+    uint32_t getMaxSubsteps() const { return m_maxSubsteps; }
+
+    // non-positive or non-finite tick falls back to DEFAULT_TICK (advance divides by it)
+    void setTickDt(float tickDt) { m_tickDt = std::isfinite(tickDt) && tickDt > 0.0f ? tickDt : DEFAULT_TICK; }
+    float getTickDt() const { return m_tickDt; }
+    uint64_t getTick() const { return m_tick; }
+    double getTime() const { return static_cast<double>(m_tick) * m_tickDt; }
+
+    // blended states in pool order and local frame (camera-relative under floating origin), rebuilt by advance(),
+    // valid until next advance()
+    const std::vector<RenderState>& getRenderStates() const { return m_renderStates; }
+    const FrameStats& getFrameStats() const { return m_frameStats; }
+
+private:
+    // state before last tick, per type and slot
+    struct PreviousState {
+        math::Vec3 position;
+        math::Quat orientation;
+        uint32_t generation;
+        bool valid = false;
+    };
+
+    PhysicsWorld m_world;
+    DefaultBodyPool m_bodies;
+    std::unique_ptr<math::IIntegrator> m_integrator;
+    collision::CollisionDetection* m_detection;
+
+    float m_tickDt;
+    uint32_t m_maxSubsteps = DEFAULT_MAX_SUBSTEPS;
+    double m_accumulator = 0.0;
+    uint64_t m_tick = 0;
+
+    TickCallback m_tickCallback;
+
+    bool m_floatingOrigin = false;
+    float m_rebaseDistance = DEFAULT_REBASE_DISTANCE;
+    std::function<bool(math::Vec3&)> m_originFocus;
+    RebaseCallback m_rebaseCallback;
+    uint32_t m_rebases = 0;
+
+    std::vector<std::vector<PreviousState>> m_previous;
+    std::vector<RenderState> m_renderStates;
+    FrameStats m_frameStats;
+
+    void step(bool keepPrevious);
+    void buildRenderStates(float alpha);
+    void updateOrigin();
+};
+
+} // namespace dynamics
+} // namespace BulletPhysics
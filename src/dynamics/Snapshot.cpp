@@ -0,0 +1,210 @@
+/*
+ * Snapshot.cpp
+ */
+
+#include "Snapshot.h"
+
+#include "collision/BoxCollider.h"
+#include "collision/CapsuleCollider.h"
+#include "collision/CylinderCollider.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+namespace BulletPhysics {
+namespace dynamics {
+
+namespace {
+
+BodyRecord recordBody(IPhysicsBody& body, uint64_t key, uint32_t generation)
+{
+    BodyRecord record{key, generation, body.getPosition(), body.getVelocity(), math::Quat{}, math::Vec3{}, 0.0f};
+
+    if (const IRotationalBody* rotational = body.getRotational())
+    {
+        record.orientation = rotational->getOrientation();
+        record.angularVelocity = rotational->getAngularVelocity();
+    }
+    if (const projectile::IProjectileBody* projectile = body.getProjectile())
+    {
+        record.spinRate = projectile->getSpinRate();
+    }
+
+    return record;
+}
+
+// spin of 6-DOF bodies lives in angular velocity
+void applyBody(IPhysicsBody& body, const BodyRecord& record, const math::Vec3& shift)
+{
+    body.setPosition(record.position + shift);
+    body.setVelocity(record.velocity);
+
+    if (IRotationalBody* rotational = body.getRotational())
+    {
+        rotational->setOrientation(record.orientation);
+        rotational->setAngularVelocity(record.angularVelocity);
+    }
+    else if (projectile::IProjectileBody* projectile = body.getProjectile())
+    {
+        projectile->setSpinRate(record.spinRate);
+    }
+}
+
+} // namespace
+
+void readColliderPose(const collision::Collider& collider, ColliderRecord& outRecord)
+{
+    outRecord.position = collider.getPosition();
+    outRecord.axisX = {1.0f, 0.0f, 0.0f};
+    outRecord.axisY = {0.0f, 1.0f, 0.0f};
+
+    switch (collider.getShape()) {
+        case collision::CollisionShape::Box:
+        {
+            const math::Vec3* axes = static_cast<const collision::BoxCollider&>(collider).getAxes();
+            outRecord.axisX = axes[0];
+            outRecord.axisY = axes[1];
+            break;
+        }
+        case collision::CollisionShape::Capsule:
+            outRecord.axisX = static_cast<const collision::CapsuleCollider&>(collider).getAxis();
+            break;
+        case collision::CollisionShape::Cylinder:
+            outRecord.axisX = static_cast<const collision::CylinderCollider&>(collider).getAxis();
+            break;
+        default:
+            break;
+    }
+
+    // farthest bounds corner from position
+    const collision::AABB bounds = collider.getBounds();
+    const math::Vec3 reach{
+        std::max(std::abs(bounds.min.x - outRecord.position.x), std::abs(bounds.max.x - outRecord.position.x)),
+        std::max(std::abs(bounds.min.y - outRecord.position.y), std::abs(bounds.max.y - outRecord.position.y)),
+        std::max(std::abs(bounds.min.z - outRecord.position.z), std::abs(bounds.max.z - outRecord.position.z))
+    };
+    outRecord.radius = std::isfinite(reach.x + reach.y + reach.z) ? reach.length() : std::numeric_limits<float>::infinity();
+}
+
+void writeColliderPose(collision::Collider& collider, const ColliderRecord& record)
+{
+    collider.setPosition(record.position);
+
+    switch (collider.getShape()) {
+        case collision::CollisionShape::Box:
+            static_cast<collision::BoxCollider&>(collider).setAxes(record.axisX, record.axisY, record.axisX.cross(record.axisY));
+            break;
+        case collision::CollisionShape::Capsule:
+            static_cast<collision::CapsuleCollider&>(collider).setAxis(record.axisX);
+            break;
+        case collision::CollisionShape::Cylinder:
+            static_cast<collision::CylinderCollider&>(collider).setAxis(record.axisX);
+            break;
+        default:
+            break;
+    }
+}
+
+void captureSnapshot(Simulation* simulation, const collision::CollisionDetection* detection, Snapshot& outSnapshot)
+{
+    outSnapshot.bodies.clear();
+    outSnapshot.colliders.clear();
+    outSnapshot.tick = simulation ? simulation->getTick() : 0;
+    outSnapshot.origin = simulation ? simulation->getOrigin() : math::Vec3d{};
+
+    if (simulation)
+    {
+        outSnapshot.bodies.reserve(simulation->getBodies().size());
+        simulation->getBodies().forEachStorage([&](auto& storage, size_t type)
+        {
+            const size_t begin = outSnapshot.bodies.size();
+            for (size_t i = 0; i < storage.size(); i++)
+            {
+                const auto handle = storage.handleAt(i);
+                outSnapshot.bodies.push_back(recordBody(storage.at(i), BodyRecord::makeKey(static_cast<uint32_t>(type), handle.index), handle.generation));
+            }
+
+            // dense order is slot order until despawn swaps, types are already in key order
+            const auto byKey = [](const BodyRecord& a, const BodyRecord& b) { return a.key < b.key; };
+            if (!std::is_sorted(outSnapshot.bodies.begin() + begin, outSnapshot.bodies.end(), byKey))
+            {
+                std::sort(outSnapshot.bodies.begin() + begin, outSnapshot.bodies.end(), byKey);
+            }
+        });
+    }
+
+    if (detection)
+    {
+        outSnapshot.colliders.reserve(detection->colliderCount());
+        detection->forEachCollider([&](const collision::Collider& collider, uint32_t id)
+        {
+            ColliderRecord record;
+            record.id = id;
+            readColliderPose(collider, record);
+            outSnapshot.colliders.push_back(record);
+        });
+
+        const auto byId = [](const ColliderRecord& a, const ColliderRecord& b) { return a.id < b.id; };
+        if (!std::is_sorted(outSnapshot.colliders.begin(), outSnapshot.colliders.end(), byId))
+        {
+            std::sort(outSnapshot.colliders.begin(), outSnapshot.colliders.end(), byId);
+        }
+    }
+}
+
+size_t restoreSnapshot(const Snapshot& snapshot, Simulation* simulation, collision::CollisionDetection* detection)
+{
+    size_t missing = 0;
+
+    // snapshot frame to current frame, whole-metre origins keep it exact
+    const math::Vec3 shift = simulation ? math::Vec3(snapshot.origin - simulation->getOrigin()) : math::Vec3{};
+
+    if (simulation)
+    {
+        simulation->getBodies().forEachStorage([&](auto& storage, size_t type)
+        {
+            using Handle = typename std::remove_reference_t<decltype(storage)>::Handle;
+
+            // records of this type form one run
+            auto first = std::lower_bound(snapshot.bodies.begin(), snapshot.bodies.end(), BodyRecord::makeKey(static_cast<uint32_t>(type), 0),
+                                          [](const BodyRecord& record, uint64_t key) { return record.key < key; });
+            for (auto it = first; it != snapshot.bodies.end() && it->type() == type; ++it)
+            {
+                if (auto* body = storage.get(Handle{it->slot(), it->generation}))
+                {
+                    applyBody(*body, *it, shift);
+                }
+                else
+                {
+                    missing++;
+                }
+            }
+        });
+    }
+    else
+    {
+        missing += snapshot.bodies.size();
+    }
+
+    for (const ColliderRecord& record : snapshot.colliders)
+    {
+        collision::Collider* collider = detection ? detection->getCollider(record.id) : nullptr;
+        if (collider)
+        {
+            ColliderRecord shifted = record;
+            shifted.position += shift;
+            writeColliderPose(*collider, shifted);
+        }
+        else
+        {
+            missing++;
+        }
+    }
+
+    return missing;
+}
+
+} // namespace dynamics
+} // namespace BulletPhysics
@@ -0,0 +1,64 @@
+/*
+ * Snapshot.h
+ */
+
+#pragma once
+
+#include "Simulation.h"
+#include "collision/CollisionDetection.h"
+#include "math/Quat.h"
+#include "math/Vec3.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace BulletPhysics {
+namespace dynamics {
+
+// dynamic state of pooled body, plain data
+struct BodyRecord {
+    uint64_t key;                   // type << 32 | slot
+    uint32_t generation;
+    math::Vec3 position;
+    math::Vec3 velocity;
+    math::Quat orientation;         // identity for point-mass bodies
+    math::Vec3 angularVelocity;
+    float spinRate;                 // 0 for plain bodies
+
+    // type in high word, so any slot index gets its own key
+    static uint64_t makeKey(uint32_t type, uint32_t slot) { return static_cast<uint64_t>(type) << 32 | slot; }
+    uint32_t type() const { return static_cast<uint32_t>(key >> 32); }
+    uint32_t slot() const { return static_cast<uint32_t>(key); }
+};
+
+// pose of collider, plain data
+struct ColliderRecord {
+    uint32_t id;                    // from CollisionDetection::addCollider
+    float radius;                   // bounding sphere about position, infinite for unbounded terrain
+    math::Vec3 position;
+    math::Vec3 axisX;               // box x axis, capsule and cylinder axis
+    math::Vec3 axisY;               // box y axis
+};
+
+// all dynamic state of one tick, records sorted by key and id
+struct Snapshot {
+    uint64_t tick = 0;
+    math::Vec3d origin;             // world origin at capture, positions are offsets from it
+    std::vector<BodyRecord> bodies;
+    std::vector<ColliderRecord> colliders;
+};
+
+// copy state of simulation bodies and colliders (either may be null) into snapshot, reusing its buffers
+void captureSnapshot(Simulation* simulation, const collision::CollisionDetection* detection, Snapshot& outSnapshot);
+
+// write snapshot back into bodies and colliders still alive, bodies spawned or despawned since capture
+// are neither removed nor recreated; positions are re-expressed in current origin when floating origin moved
+// since capture (colliders without simulation stay in snapshot's frame); returns number of records that found no target
+size_t restoreSnapshot(const Snapshot& snapshot, Simulation* simulation, collision::CollisionDetection* detection);
+
+// collider pose from and to record (position and shape axes)
+void readColliderPose(const collision::Collider& collider, ColliderRecord& outRecord);
+void writeColliderPose(collision::Collider& collider, const ColliderRecord& record);
+
+} // namespace dynamics
+} // namespace BulletPhysics
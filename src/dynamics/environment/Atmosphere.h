@@ -6,6 +6,7 @@
 
 #include "Environment.h"
 #include "Constants.h"
+#include "math/Transcendental.h"
 
 #include <cmath>
 
@@ -27,13 +28,15 @@ public:
 
     void update(IPhysicsBody& body, PhysicsContext& context) override
     {
-        float altitude = std::max(0.0f, std::min(body.getPosition().y - m_groundY, constants::TROPOSPHERE_MAX));
+        // world height in double, local offset alone loses ground level under floating origin
+        const double height = context.origin.y + body.getPosition().y - m_groundY;
+        float altitude = std::max(0.0f, std::min(static_cast<float>(height), constants::TROPOSPHERE_MAX));
 
         // linear temperature decrease: T = T0 - L * h
         float temperature = m_baseTemperature - constants::LAPSE_RATE * altitude;
 
         // barometric formula: p = p0 * (T / T0)^(g / (R * L))
-        float pressure = m_basePressure * std::pow(temperature / m_baseTemperature, BAROMETRIC_EXP);
+        float pressure = m_basePressure * math::fp::pow(temperature / m_baseTemperature, BAROMETRIC_EXP);
 
         // ideal gas law: rho = p / (R * T)
         float density = pressure / (constants::GAS_CONSTANT_DRY_AIR * temperature);
@@ -43,11 +46,9 @@ public:
         context.airDensity = density;
     }
 
-    const std::string& getName() const override { return m_name; }
+    std::string_view getName() const override { return "Atmosphere"; }
 
 private:
-    std::string m_name = "Atmosphere";
-
     // barometric formula exponent: g / (R * L)
     static inline const float BAROMETRIC_EXP = constants::GRAVITY.length() / (constants::GAS_CONSTANT_DRY_AIR * constants::LAPSE_RATE);
 
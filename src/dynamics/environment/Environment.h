@@ -7,7 +7,7 @@
 #include "dynamics/PhysicsBody.h"
 #include "dynamics/PhysicsContext.h"
 
-#include <string>
+#include <string_view>
 
 namespace BulletPhysics {
 namespace dynamics {
@@ -21,7 +21,8 @@ public:
     // update physics context based on physics body state
     virtual void update(IPhysicsBody& body, PhysicsContext& context) = 0;
 
-    virtual const std::string& getName() const = 0;
+    // refers to static storage (string literal)
+    virtual std::string_view getName() const = 0;
 };
 
 } // namespace environment
@@ -24,7 +24,7 @@ public:
     void update(IPhysicsBody& body, PhysicsContext& context) override
     {
         // calculate altitude above ground level
-        float altitudeAbove = std::max(0.0f, body.getPosition().y - m_groundY);
+        float altitudeAbove = std::max(0.0f, static_cast<float>(context.origin.y + body.getPosition().y - m_groundY));
 
         // store geographic information
         context.latitude = m_reference.latitude;
@@ -37,14 +37,12 @@ public:
         context.gravity = geography::gravitationalAccelerationAtGeodetic(currentPosition);
     }
 
-    const std::string& getName() const override { return m_name; }
+    std::string_view getName() const override { return "Geographic"; }
 
     double getReferenceLatitude() const { return m_reference.latitude; }
     double getReferenceLongitude() const { return m_reference.longitude; }
 
 private:
-    std::string m_name = "Geographic";
-
     geography::GeographicPosition m_reference;
     float m_groundY;
 };
@@ -6,6 +6,7 @@
 
 #include "Environment.h"
 #include "Constants.h"
+#include "math/Transcendental.h"
 
 #include <cmath>
 
@@ -41,11 +42,9 @@ public:
         context.airDensity = correctDensityForHumidity(density, temperature, pressure, m_relativeHumidity);
     }
 
-    const std::string& getName() const override { return m_name; }
+    std::string_view getName() const override { return "Humidity"; }
 
 private:
-    std::string m_name = "Humidity";
-
     float m_relativeHumidity; // % (0-100)
 
     // Tetens approximation: p_sat = 0.61078 * exp((17.27 * (T - 273.15)) / (T - 35.85))
@@ -53,7 +52,7 @@ private:
     {
         float tempC = tempK - constants::CELSIUS_TO_KELVIN;
         float exponent = constants::TETENS_A * tempC / (tempK + constants::TETENS_B);
-        return constants::TETENS_C * std::exp(exponent);
+        return constants::TETENS_C * math::fp::exp(exponent);
     }
 
     // correct air density for humidity
@@ -23,11 +23,9 @@ public:
     void setWind(const math::Vec3& windVel) { m_velocity = windVel; }
     const math::Vec3& getWind() const { return m_velocity; }
 
-    const std::string& getName() const override { return m_name; }
+    std::string_view getName() const override { return "Wind"; }
 
 private:
-    std::string m_name = "Wind";
-
     math::Vec3 m_velocity;
 };
 
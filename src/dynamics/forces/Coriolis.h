@@ -6,6 +6,7 @@
 
 #include "Force.h"
 #include "Constants.h"
+#include "math/Transcendental.h"
 
 #include <cmath>
 
@@ -30,9 +31,8 @@ public:
         // Earth's angular velocity vector in ENU frame
         // omega = (0, omega*cos(lat), omega*sin(lat))
         // our coordinate system: x=East, y=Up, z=North
-        double omegaNorth = constants::EARTH_ANGULAR_SPEED * std::cos(latitude);
-        double omegaUp = constants::EARTH_ANGULAR_SPEED * std::sin(latitude);
-        math::Vec3 omega(0.0f, static_cast<float>(omegaUp), static_cast<float>(omegaNorth));
+        math::Vec3d omegaEarth(0.0, math::fp::sin(latitude), math::fp::cos(latitude));
+        math::Vec3 omega(omegaEarth * constants::EARTH_ANGULAR_SPEED);
 
         // Coriolis acceleration: a = -2 * (omega x v)
         math::Vec3 coriolisAccel = -2.0f * omega.cross(velocity);
@@ -46,12 +46,8 @@ public:
         }
     }
 
-    const std::string& getName() const override { return m_name; }
-    const std::string& getSymbol() const override { return m_symbol; }
-
-private:
-    std::string m_name = "Coriolis";
-    std::string m_symbol = "Fc";
+    std::string_view getName() const override { return "Coriolis"; }
+    std::string_view getSymbol() const override { return "Fc"; }
 };
 
 } // namespace forces
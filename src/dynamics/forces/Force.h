@@ -8,7 +8,7 @@
 #include "dynamics/PhysicsContext.h"
 #include "math/Vec3.h"
 
-#include <string>
+#include <string_view>
 
 namespace BulletPhysics {
 namespace dynamics {
@@ -25,9 +25,9 @@ public:
     // check if this force should be active
     virtual bool isActive() const { return true; }
 
-    // getters
-    virtual const std::string& getName() const = 0;
-    virtual const std::string& getSymbol() const = 0;
+    // getters, names refer to static storage (string literals)
+    virtual std::string_view getName() const = 0;
+    virtual std::string_view getSymbol() const = 0;
     virtual math::Vec3 getForce() const { return m_force; }
 
 protected:
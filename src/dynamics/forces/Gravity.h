@@ -37,12 +37,8 @@ public:
         }
     }
 
-    const std::string& getName() const override { return m_name; }
-    const std::string& getSymbol() const override { return m_symbol; }
-
-private:
-    std::string m_name = "Gravitational";
-    std::string m_symbol = "Fg";
+    std::string_view getName() const override { return "Gravitational"; }
+    std::string_view getSymbol() const override { return "Fg"; }
 };
 
 } // namespace forces
@@ -0,0 +1,72 @@
+/*
+ * SpinDecay.h
+ */
+
+#pragma once
+
+#include "Force.h"
+#include "drag/MachReynoldsTable.h"
+#include "dynamics/PhysicsBody.h"
+#include "dynamics/ProjectileStore.h"
+#include "Constants.h"
+
+#include <cmath>
+
+namespace BulletPhysics {
+namespace dynamics {
+namespace forces {
+
+// roll damping moment, adds spin acceleration to projectile and no translational force
+class SpinDecay : public IForce {
+public:
+    void apply(IPhysicsBody& body, PhysicsContext& context, float /*dt*/) override
+    {
+        // requires spinning projectile
+        auto* projectile = body.getProjectile();
+        if (!projectile)
+        {
+            return;
+        }
+
+        const auto& load = projectile->getLoad();
+        if (!load.spinning)
+        {
+            return;
+        }
+
+        float p = projectile->getSpinRate();
+        if (p == 0.0f)
+        {
+            return;
+        }
+
+        // air-relative velocity
+        math::Vec3 velocity = body.getVelocity();
+        if (context.wind.has_value())
+        {
+            velocity = velocity - *context.wind;
+        }
+        float velocityMagnitude = velocity.length();
+
+        // Mach = u / c, c from air temperature when known
+        float c = context.airTemperature.has_value() ? drag::speedOfSound(*context.airTemperature) : constants::BASE_SPEED_OF_SOUND;
+        float mach = velocityMagnitude / c;
+
+        // data
+        float rho = context.airDensity.value_or(constants::BASE_ATMOSPHERIC_DENSITY);
+        float S = load.area;
+        float d = load.diameter;
+        float Ix = load.axialInertia;
+        float C_spin = load.rollDampingAt(mach);
+
+        // dp/dt = rho * S * d^2 * p * V * C_spin / (2 * Ix)
+        projectile->addSpinAcceleration(0.5f * rho * S * d * d * p * velocityMagnitude * C_spin / Ix);
+    }
+
+    std::string_view getName() const override { return "Spin Decay"; }
+    std::string_view getSymbol() const override { return "Ms"; }
+};
+
+} // namespace forces
+} // namespace dynamics
+} // namespace BulletPhysics
@@ -6,6 +6,7 @@
 
 #include "Force.h"
 #include "dynamics/PhysicsBody.h"
+#include "dynamics/ProjectileStore.h"
 #include "Constants.h"
 #include "math/Vec3.h"
 
@@ -16,30 +17,14 @@ namespace BulletPhysics {
 namespace dynamics {
 namespace forces {
 
-// helper function to check if specs have required data for spin drift calculations
-static bool hasSpinDriftData(const projectile::ProjectileSpecs& specs)
-{
-    if (!specs.diameter.has_value()) return false;
-    if (!specs.area.has_value()) return false;
-
-    if (!specs.spinSpecs.has_value()) return false;
-    const auto& spin = *specs.spinSpecs;
-
-    if (!spin.momentOfInertia.has_value()) return false;
-    if (!spin.spinRate.has_value()) return false;
-
-    return true;
-}
-
 // yaw of repose: alpha_e = 2 * Ix * p * (g x V) / (rho * S * d * V^4 * C_M_alpha)
-static math::Vec3 calculateYawOfRepose(const projectile::ProjectileSpecs& specs, const PhysicsContext& context, const math::Vec3& velocity)
+static math::Vec3 calculateYawOfRepose(const projectile::ProjectileLoad& load, const PhysicsContext& context, const math::Vec3& velocity, float spinRate)
 {
     // requers projectile spin specs
-    if (!hasSpinDriftData(specs))
+    if (!load.spinning)
     {
         return {0.0f, 0.0f, 0.0f};
     }
-    const auto& spinSpecs = specs.spinSpecs.value();
 
     // velocity
     float velocityMagnitude = velocity.length();
@@ -50,46 +35,31 @@ static math::Vec3 calculateYawOfRepose(const projectile::ProjectileSpecs& specs,
 
     // denominator
     float rho = context.airDensity.value_or(constants::BASE_ATMOSPHERIC_DENSITY);
-    float S = specs.area.value();
-    float d = specs.diameter.value();
     float velocityMagnitudePow4 = velocityMagnitude * velocityMagnitude * velocityMagnitude * velocityMagnitude;
-    float C_M_alpha = spinSpecs.overtuningCoefficient;
 
-    float denominator = rho * S * d * velocityMagnitudePow4 * C_M_alpha;
+    float denominator = rho * load.area * load.diameter * velocityMagnitudePow4 * load.overturningCoefficient;
 
     // numerator
-    float Ix = spinSpecs.momentOfInertia.value();
-    float p = spinSpecs.spinRate.value();
     math::Vec3 g = constants::GRAVITY;
     math::Vec3 gCrossV = g.cross(velocity);
 
-    math::Vec3 numerator = 2.0f * Ix * p * gCrossV;
+    math::Vec3 numerator = 2.0f * load.axialInertia * spinRate * gCrossV;
 
     // final
-    int spinSign = spinSpecs.riflingSpecs->direction == projectile::RiflingSpecs::Direction::RIGHT ? 1 : -1;
-
-    return spinSign * numerator / denominator;
+    return load.spinSign * numerator / denominator;
 }
 
 class Lift : public IForce {
 public:
     void apply(IPhysicsBody& body, PhysicsContext& context, float /*dt*/) override
     {
-        // requires projectile body
-        auto* projectile = dynamic_cast<projectile::IProjectileBody*>(&body);
-        if (!projectile)
+        // requires spinning projectile body
+        auto* projectile = body.getProjectile();
+        if (!projectile || !projectile->getLoad().spinning)
         {
             return;
         }
-
-        const auto& specs = projectile->getProjectileSpecs();
-
-        // requers projectile spin specs
-        if (!hasSpinDriftData(specs))
-        {
-            return;
-        }
-        const auto& spinSpecs = specs.spinSpecs.value();
+        const auto& load = projectile->getLoad();
 
         // velocity
         math::Vec3 velocity = body.getVelocity();
@@ -102,11 +72,11 @@ public:
 
         // data
         float rho = context.airDensity.value_or(constants::BASE_ATMOSPHERIC_DENSITY);
-        float S = specs.area.value();
-        float C_L_alpha = spinSpecs.liftCoefficient;
+        float S = load.area;
+        float C_L_alpha = load.liftCoefficient;
 
         // yaw of repose
-        math::Vec3 alpha_e = calculateYawOfRepose(specs, context, velocity);
+        math::Vec3 alpha_e = calculateYawOfRepose(load, context, velocity, projectile->getSpinRate());
 
         // F_l = 1/2 * rho * S * C_L_alpha * V^2 * alpha_e
         math::Vec3 force = 0.5f * rho * S * C_L_alpha * velocityMagnitudePow2 * alpha_e;
@@ -115,33 +85,21 @@ public:
         m_force = force;
     }
 
-    const std::string& getName() const override { return m_name; }
-    const std::string& getSymbol() const override { return m_symbol; }
-
-private:
-    std::string m_name = "Lift";
-    std::string m_symbol = "Fl";
+    std::string_view getName() const override { return "Lift"; }
+    std::string_view getSymbol() const override { return "Fl"; }
 };
 
 class Magnus : public IForce {
 public:
     void apply(IPhysicsBody& body, PhysicsContext& context, float /*dt*/) override
     {
-        // requires projectile body
-        auto* projectile = dynamic_cast<projectile::IProjectileBody*>(&body);
-        if (!projectile)
+        // requires spinning projectile body
+        auto* projectile = body.getProjectile();
+        if (!projectile || !projectile->getLoad().spinning)
         {
             return;
         }
-
-        const auto& specs = projectile->getProjectileSpecs();
-
-        // requers projectile spin specs
-        if (!hasSpinDriftData(specs))
-        {
-            return;
-        }
-        const auto& spinSpecs = specs.spinSpecs.value();
+        const auto& load = projectile->getLoad();
 
         // velocity
         math::Vec3 velocity = body.getVelocity();
@@ -153,13 +111,13 @@ public:
 
         // data
         float rho = context.airDensity.value_or(constants::BASE_ATMOSPHERIC_DENSITY);
-        float d = specs.diameter.value();
-        float S = specs.area.value();
-        float p = spinSpecs.spinRate.value();
-        float C_mag_f = spinSpecs.magnusCoefficient;
+        float d = load.diameter;
+        float S = load.area;
+        float p = projectile->getSpinRate();
+        float C_mag_f = load.magnusCoefficient;
 
         // yaw of repose
-        math::Vec3 alpha_e = calculateYawOfRepose(specs, context, velocity);
+        math::Vec3 alpha_e = calculateYawOfRepose(load, context, velocity, p);
         math::Vec3 alphaCrossV = alpha_e.cross(velocity);
 
         // F_m = -1/2 * rho * S * d * p * C_mag_f * (alpha_e x V)
@@ -169,12 +127,8 @@ public:
         m_force = force;
     }
 
-    const std::string& getName() const override { return m_name; }
-    const std::string& getSymbol() const override { return m_symbol; }
-
-private:
-    std::string m_name = "Magnus";
-    std::string m_symbol = "Fm";
+    std::string_view getName() const override { return "Magnus"; }
+    std::string_view getSymbol() const override { return "Fm"; }
 };
 
 // spin drift influence
@@ -6,6 +6,7 @@
 
 #include "dynamics/forces/Force.h"
 #include "dynamics/PhysicsBody.h"
+#include "dynamics/ProjectileStore.h"
 #include "Constants.h"
 #include "DragModel.h"
 
@@ -35,41 +36,37 @@ public:
         // get air density from context or use default
         float rho = context.airDensity.value_or(constants::BASE_ATMOSPHERIC_DENSITY);
 
-        // Mach = u / c
-        float mach = velocityMagnitude / constants::BASE_SPEED_OF_SOUND;
+        // Mach = u / c, c from air temperature when known
+        float c = context.airTemperature.has_value() ? speedOfSound(*context.airTemperature) : constants::BASE_SPEED_OF_SOUND;
+        float mach = velocityMagnitude / c;
 
-        float cd = constants::DEFAULT_CD;
-        float area = constants::DEFAULT_AREA;
-
-        // try to use projectile specs if available
-        auto* projectile = dynamic_cast<projectile::IProjectileBody*>(&body);
-        if (projectile)
+        // C_d * S from load table (form factor and BC folded in)
+        float dragArea = constants::DEFAULT_CD * constants::DEFAULT_AREA;
+        if (auto* projectile = body.getProjectile())
         {
-            const auto& specs = projectile->getProjectileSpecs();
-            if (specs.dragModel.has_value())
+            const auto& load = projectile->getLoad();
+            if (load.reynoldsDependent())
             {
-                cd = StandardDragModel(specs.dragModel.value()).getCd(mach);
+                // Re = rho * u * d / mu
+                float mu = airViscosity(context.airTemperature.value_or(constants::BASE_TEMPERATURE));
+                float reynolds = rho * velocityMagnitude * load.diameter / mu;
+                dragArea = load.dragAreaAt(mach, velocityMagnitude, reynolds);
             }
-
-            if (specs.area.has_value())
+            else
             {
-                area = specs.area.value();
+                dragArea = load.dragAreaAt(mach, velocityMagnitude);
             }
         }
 
         // F_d = -0.5 * rho * S * Cd * v * |v|
-        math::Vec3 force = -0.5f * rho * area * cd * velocity * velocityMagnitude;
+        math::Vec3 force = -0.5f * rho * dragArea * velocity * velocityMagnitude;
 
         body.addForce(force);
         m_force = force;
     }
 
-    const std::string& getName() const override { return m_name; }
-    const std::string& getSymbol() const override { return m_symbol; }
-
-private:
-    std::string m_name = "Aerodynamic Drag";
-    std::string m_symbol = "Fd";
+    std::string_view getName() const override { return "Aerodynamic Drag"; }
+    std::string_view getSymbol() const override { return "Fd"; }
 };
 
 } // namespace drag
@@ -3,7 +3,13 @@
  */
 
 #include "DragModel.h"
+#include "math/Transcendental.h"
+
 #include <iostream>
+#include <cstdio>
+#include <filesystem>
+#include <iterator>
+#include <utility>
 
 namespace BulletPhysics {
 namespace dynamics {
@@ -147,6 +153,382 @@ float StandardDragModel::getCd(float mach) const
     return m_curve.getCd(mach);
 }
 
+namespace {
+
+// cache file layout, native byte order (cache is local to machine that wrote it)
+constexpr char CACHE_MAGIC[4] = {'B', 'P', 'D', 'C'};
+constexpr uint32_t CACHE_VERSION = 1;
+
+template <typename T>
+void writeValue(std::ofstream& file, const T& value)
+{
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool readValue(std::ifstream& file, T& value)
+{
+    return static_cast<bool>(file.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+} // namespace
+
+CustomCurveDragModel::CustomCurveDragModel(const std::string& filename, const std::string& cacheDirectory) : m_filename(filename)
+{
+    // constant fallback until curve is loaded
+    m_table = DragTable::constant(constants::DEFAULT_CD);
+
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open())
+    {
+        std::cerr << "failed to load curve from: " << filename << std::endl;
+        return;
+    }
+    const std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    const uint64_t hash = contentHash(content);
+    char name[32];
+    std::snprintf(name, sizeof(name), "drag_%016llx.bin", static_cast<unsigned long long>(hash));
+
+    const std::filesystem::path directory = cacheDirectory.empty() ? std::filesystem::path(filename).parent_path() : std::filesystem::path(cacheDirectory);
+    const std::string cachePath = (directory / name).string();
+
+    if (readCache(cachePath, hash, m_table))
+    {
+        m_loaded = true;
+        m_fromCache = true;
+        return;
+    }
+
+    std::vector<float> machNumbers;
+    std::vector<float> dragCoefficients;
+    if (!parse(content, machNumbers, dragCoefficients))
+    {
+        std::cerr << "failed to parse curve from: " << filename << std::endl;
+        return;
+    }
+
+    m_table = fit(machNumbers, dragCoefficients);
+    m_loaded = true;
+
+    // unwritable directory only costs refit next time
+    writeCache(cachePath, hash, m_table);
+}
+
+uint64_t CustomCurveDragModel::contentHash(const std::string& content)
+{
+    uint64_t hash = 14695981039346656037ull;
+    for (unsigned char c : content)
+    {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+bool CustomCurveDragModel::parse(const std::string& content, std::vector<float>& machNumbers, std::vector<float>& dragCoefficients)
+{
+    std::vector<std::pair<float, float>> points;
+
+    std::istringstream stream(content);
+    std::string line;
+    while (std::getline(stream, line))
+    {
+        if (line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+
+        // separators to spaces, then same reading as DragCurve
+        std::replace_if(line.begin(), line.end(), [](char c) { return c == ',' || c == ';' || c == '\t'; }, ' ');
+
+        std::istringstream iss(line);
+        float mach;
+        float cd;
+
+        // non-numeric lines (header) skipped
+        if (iss >> mach >> cd && std::isfinite(mach) && std::isfinite(cd) && mach >= 0.0f)
+        {
+            points.emplace_back(mach, cd);
+        }
+    }
+
+    if (points.empty())
+    {
+        return false;
+    }
+
+    // measurements come in any order, repeated Mach averaged
+    std::stable_sort(points.begin(), points.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    machNumbers.clear();
+    dragCoefficients.clear();
+    for (size_t i = 0; i < points.size();)
+    {
+        size_t j = i;
+        double sum = 0.0;
+        while (j < points.size() && points[j].first == points[i].first)
+        {
+            sum += points[j].second;
+            j++;
+        }
+
+        machNumbers.push_back(points[i].first);
+        dragCoefficients.push_back(static_cast<float>(sum / static_cast<double>(j - i)));
+        i = j;
+    }
+
+    return true;
+}
+
+DragTable CustomCurveDragModel::fit(const std::vector<float>& machNumbers, const std::vector<float>& dragCoefficients)
+{
+    const size_t n = machNumbers.size();
+    if (n == 1)
+    {
+        return DragTable::constant(dragCoefficients[0]);
+    }
+
+    // secant slopes
+    std::vector<double> h(n - 1);
+    std::vector<double> delta(n - 1);
+    for (size_t k = 0; k + 1 < n; k++)
+    {
+        h[k] = static_cast<double>(machNumbers[k + 1]) - machNumbers[k];
+        delta[k] = (static_cast<double>(dragCoefficients[k + 1]) - dragCoefficients[k]) / h[k];
+    }
+
+    // Fritsch-Carlson tangents: zero at local extrema, weighted harmonic mean of secants elsewhere,
+    // keeps each interval monotone so noise cannot ring past the samples
+    std::vector<double> slope(n);
+    slope[0] = delta[0];
+    slope[n - 1] = delta[n - 2];
+    for (size_t k = 1; k + 1 < n; k++)
+    {
+        if (delta[k - 1] * delta[k] <= 0.0)
+        {
+            slope[k] = 0.0;
+            continue;
+        }
+
+        const double w1 = 2.0 * h[k] + h[k - 1];
+        const double w2 = h[k] + 2.0 * h[k - 1];
+        slope[k] = (w1 + w2) / (w1 / delta[k - 1] + w2 / delta[k]);
+    }
+
+    // grid is ascending, so interval only walks forward
+    size_t k = 0;
+    return DragTable::sample([&](float mach)
+    {
+        if (mach <= machNumbers.front())
+        {
+            return dragCoefficients.front();
+        }
+        if (mach >= machNumbers.back())
+        {
+            return dragCoefficients.back();
+        }
+
+        while (machNumbers[k + 1] < mach)
+        {
+            k++;
+        }
+
+        // cubic Hermite on [x_k, x_k+1]
+        const double t = (static_cast<double>(mach) - machNumbers[k]) / h[k];
+        const double t2 = t * t;
+        const double t3 = t2 * t;
+
+        const double h00 = 2.0 * t3 - 3.0 * t2 + 1.0;
+        const double h10 = t3 - 2.0 * t2 + t;
+        const double h01 = -2.0 * t3 + 3.0 * t2;
+        const double h11 = t3 - t2;
+
+        return static_cast<float>(h00 * dragCoefficients[k] + h10 * h[k] * slope[k] + h01 * dragCoefficients[k + 1] + h11 * h[k] * slope[k + 1]);
+    });
+}
+
+bool CustomCurveDragModel::readCache(const std::string& path, uint64_t hash, DragTable& table)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    // any mismatch (other version, grid or content) means refit
+    char magic[4];
+    uint32_t version;
+    uint64_t storedHash;
+    float step;
+    float maxMach;
+    uint32_t count;
+    if (!file.read(magic, sizeof(magic)) || !std::equal(magic, magic + 4, CACHE_MAGIC) ||
+        !readValue(file, version) || version != CACHE_VERSION ||
+        !readValue(file, storedHash) || storedHash != hash ||
+        !readValue(file, step) || step != DragTable::MACH_STEP ||
+        !readValue(file, maxMach) || maxMach != DragTable::MAX_MACH ||
+        !readValue(file, count) || count != DragTable::GRID_SIZE)
+    {
+        return false;
+    }
+
+    std::vector<float> values(count);
+    if (!file.read(reinterpret_cast<char*>(values.data()), static_cast<std::streamsize>(count * sizeof(float))))
+    {
+        return false;
+    }
+
+    table = DragTable::fromValues(std::move(values));
+    return !table.empty();
+}
+
+bool CustomCurveDragModel::writeCache(const std::string& path, uint64_t hash, const DragTable& table)
+{
+    // single constant value when fit had one sample, not worth caching
+    if (table.size() != DragTable::GRID_SIZE)
+    {
+        return false;
+    }
+
+    // write aside and rename, so concurrent reader never sees partial file
+    const std::string temporary = path + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            return false;
+        }
+
+        file.write(CACHE_MAGIC, sizeof(CACHE_MAGIC));
+        writeValue(file, CACHE_VERSION);
+        writeValue(file, hash);
+        writeValue(file, DragTable::MACH_STEP);
+        writeValue(file, DragTable::MAX_MACH);
+        writeValue(file, static_cast<uint32_t>(table.size()));
+        file.write(reinterpret_cast<const char*>(table.values().data()), static_cast<std::streamsize>(table.size() * sizeof(float)));
+
+        if (!file)
+        {
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporary, path, error);
+    if (error)
+    {
+        std::filesystem::remove(temporary, error);
+        return false;
+    }
+    return true;
+}
+
+ReynoldsDragModel::ReynoldsDragModel(const std::string& filename) : m_filename(filename)
+{
+    // constant fallback until table is loaded
+    m_table = MachReynoldsTable::sample(0.0f, 0.0f, 1.0f, 1.0f, [](float, float) { return constants::DEFAULT_CD; });
+
+    std::ifstream file(filename);
+    if (!file.is_open())
+    {
+        std::cerr << "failed to load drag table from: " << filename << std::endl;
+        return;
+    }
+
+    std::vector<double> logReynolds;
+    std::vector<float> machNumbers;
+    std::vector<std::vector<float>> rows;
+
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+        std::replace_if(line.begin(), line.end(), [](char c) { return c == ',' || c == ';' || c == '\t'; }, ' ');
+
+        // header: corner label, then Reynolds numbers
+        std::istringstream iss(line);
+        if (logReynolds.empty())
+        {
+            std::string label;
+            iss >> label;
+
+            double reynolds;
+            while (iss >> reynolds)
+            {
+                logReynolds.push_back(math::fp::log(std::max(reynolds, 1.0)));
+            }
+            continue;
+        }
+
+        float mach;
+        if (!(iss >> mach))
+        {
+            continue;
+        }
+
+        std::vector<float> row;
+        float cd;
+        while (iss >> cd)
+        {
+            row.push_back(cd);
+        }
+
+        if (row.size() == logReynolds.size())
+        {
+            machNumbers.push_back(mach);
+            rows.push_back(std::move(row));
+        }
+    }
+
+    if (logReynolds.empty() || machNumbers.empty() ||
+        !std::is_sorted(logReynolds.begin(), logReynolds.end()) || !std::is_sorted(machNumbers.begin(), machNumbers.end()))
+    {
+        std::cerr << "failed to parse drag table from: " << filename << std::endl;
+        return;
+    }
+
+    // bracketing index and fraction on ascending axis, clamped at ends
+    auto locate = [](const auto& axis, double value, size_t& index, double& t)
+    {
+        if (axis.size() == 1 || value <= axis.front())
+        {
+            index = 0;
+            t = 0.0;
+            return;
+        }
+        if (value >= axis.back())
+        {
+            index = axis.size() - 2;
+            t = 1.0;
+            return;
+        }
+
+        index = static_cast<size_t>(std::upper_bound(axis.begin(), axis.end(), value) - axis.begin()) - 1;
+        t = (value - axis[index]) / (static_cast<double>(axis[index + 1]) - axis[index]);
+    };
+
+    m_table = MachReynoldsTable::sample(machNumbers.front(), machNumbers.back(),
+                                        static_cast<float>(math::fp::exp(logReynolds.front())), static_cast<float>(math::fp::exp(logReynolds.back())),
+                                        [&](float mach, float reynolds)
+    {
+        size_t i, j;
+        double tx, ty;
+        locate(machNumbers, mach, i, tx);
+        locate(logReynolds, math::fp::log(static_cast<double>(reynolds)), j, ty);
+
+        const size_t i1 = std::min(i + 1, machNumbers.size() - 1);
+        const size_t j1 = std::min(j + 1, logReynolds.size() - 1);
+        const double low = rows[i][j] + ty * (rows[i][j1] - rows[i][j]);
+        const double high = rows[i1][j] + ty * (rows[i1][j1] - rows[i1][j]);
+        return static_cast<float>(low + tx * (high - low));
+    });
+    m_loaded = true;
+}
+
 } // namespace drag
 } // namespace forces
 } // namespace dynamics
@@ -10,8 +10,11 @@
 #include <sstream>
 #include <cmath>
 #include <algorithm>
+#include <cstdint>
 
 #include "Constants.h"
+#include "DragTable.h"
+#include "MachReynoldsTable.h"
 #include "math/Algorithms.h"
 
 namespace BulletPhysics {
@@ -99,6 +102,57 @@ private:
     float m_cd;
 };
 
+// custom Cd(Mach) table from CSV file, typically radar-derived: noisy and non-uniform; one "mach, cd" pair per line
+// (comma, semicolon or whitespace separated, header and '#' lines skipped), repeated Mach averaged;
+// fitted with monotone cubic (no overshoot between samples) and resampled to DragTable grid for O(1) lookup;
+// fit is cached as binary file named by content hash, so unchanged file skips parsing and fitting on next load
+class CustomCurveDragModel : public IDragModel {
+public:
+    // empty cache directory keeps cache next to CSV file
+    explicit CustomCurveDragModel(const std::string& filename, const std::string& cacheDirectory = "");
+
+    float getCd(float mach) const override { return m_table.at(mach); }
+
+    bool isLoaded() const { return m_loaded; }
+    bool isFromCache() const { return m_fromCache; }
+    const std::string& getFilename() const { return m_filename; }
+    const DragTable& getTable() const { return m_table; }
+
+    // FNV-1a of file content, names cache file
+    static uint64_t contentHash(const std::string& content);
+
+private:
+    std::string m_filename;
+    DragTable m_table;
+    bool m_loaded = false;
+    bool m_fromCache = false;
+
+    static bool parse(const std::string& content, std::vector<float>& machNumbers, std::vector<float>& dragCoefficients);
+    static DragTable fit(const std::vector<float>& machNumbers, const std::vector<float>& dragCoefficients);
+
+    static bool readCache(const std::string& path, uint64_t hash, DragTable& table);
+    static bool writeCache(const std::string& path, uint64_t hash, const DragTable& table);
+};
+
+// C_d(Mach, Re) for rounds whose drag depends on Reynolds number (subsonic, very small or large calibre),
+// from CSV matrix: header row "mach, Re_1, Re_2, ..." then one "mach, cd_1, cd_2, ..." row per Mach, both axes ascending;
+// interpolated bilinearly in Mach and log Re, resampled to MachReynoldsTable
+class ReynoldsDragModel {
+public:
+    explicit ReynoldsDragModel(const std::string& filename);
+
+    float getCd(float mach, float reynolds) const { return m_table.at(mach, reynolds); }
+
+    bool isLoaded() const { return m_loaded; }
+    const std::string& getFilename() const { return m_filename; }
+    const MachReynoldsTable& getTable() const { return m_table; }
+
+private:
+    std::string m_filename;
+    MachReynoldsTable m_table;
+    bool m_loaded = false;
+};
+
 } // namespace drag
 } // namespace forces
 } // namespace dynamics
@@ -0,0 +1,86 @@
+/*
+ * DragTable.h
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace BulletPhysics {
+namespace dynamics {
+namespace forces {
+namespace drag {
+
+// drag quantity sampled on uniform Mach grid, lookup is index arithmetic and one lerp instead of curve search;
+// step 0.005 hits every knot of bundled G curves, so resampling them is exact
+class DragTable {
+public:
+    static constexpr float MACH_STEP = 0.005f;
+    static constexpr float MAX_MACH = 5.0f;
+    static constexpr size_t GRID_SIZE = static_cast<size_t>(MAX_MACH / MACH_STEP + 0.5f) + 1;
+
+    DragTable() = default;
+
+    // fn(mach) at every grid point of [0, MAX_MACH]
+    template <typename Fn>
+    static DragTable sample(Fn&& fn)
+    {
+        DragTable table;
+        table.m_values.resize(GRID_SIZE);
+        for (size_t i = 0; i < GRID_SIZE; i++)
+        {
+            table.m_values[i] = fn(static_cast<float>(i) * MACH_STEP);
+        }
+        return table;
+    }
+
+    static DragTable constant(float value)
+    {
+        DragTable table;
+        table.m_values.assign(1, value);
+        return table;
+    }
+
+    // previously sampled grid values (e.g. read from cache), empty table if count does not match grid
+    static DragTable fromValues(std::vector<float> values)
+    {
+        DragTable table;
+        if (values.size() == GRID_SIZE)
+        {
+            table.m_values = std::move(values);
+        }
+        return table;
+    }
+
+    // linear between grid points, clamped at ends
+    float at(float mach) const
+    {
+        const float x = mach * (1.0f / MACH_STEP);
+        if (!(x > 0.0f))
+        {
+            return m_values.front();
+        }
+
+        const size_t i = static_cast<size_t>(x);
+        if (i + 1 >= m_values.size())
+        {
+            return m_values.back();
+        }
+
+        const float t = x - static_cast<float>(i);
+        return m_values[i] + t * (m_values[i + 1] - m_values[i]);
+    }
+
+    bool empty() const { return m_values.empty(); }
+    size_t size() const { return m_values.size(); }
+    const std::vector<float>& values() const { return m_values; }
+
+private:
+    std::vector<float> m_values;
+};
+
+} // namespace drag
+} // namespace forces
+} // namespace dynamics
+} // namespace BulletPhysics
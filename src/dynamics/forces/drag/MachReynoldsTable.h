@@ -0,0 +1,135 @@
+/*
+ * MachReynoldsTable.h
+ */
+
+#pragma once
+
+#include "Constants.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace BulletPhysics {
+namespace dynamics {
+namespace forces {
+namespace drag {
+
+// dynamic viscosity of air by Sutherland's law: mu = C1 * T^(3/2) / (T + S)
+inline float airViscosity(float temperature)
+{
+    return constants::SUTHERLAND_C1 * temperature * std::sqrt(temperature) / (temperature + constants::SUTHERLAND_S);
+}
+
+// speed of sound in dry air: c = sqrt(gamma * R * T)
+inline float speedOfSound(float temperature)
+{
+    return std::sqrt(constants::HEAT_CAPACITY_RATIO * constants::GAS_CONSTANT_DRY_AIR * temperature);
+}
+
+// drag quantity on uniform grid of Mach and log Re, bilinear between grid points, clamped at edges;
+// Re axis is float bit pattern (exponent plus linear mantissa, piecewise-linear log2), 4 cells per octave at
+// Re = 2^e * {1, 1.25, 1.5, 1.75}, so axis position is integer subtraction instead of log call;
+// each cell keeps its 4 corners (2 values, 2 slopes) in one 16-byte block, so lookup touches one cache line instead of two rows;
+// one padding cell past each upper edge repeats edge values, so clamped coordinate needs no index clamp
+class MachReynoldsTable {
+public:
+    static constexpr float MACH_STEP = 0.01f;
+    static constexpr int RE_CELLS_PER_OCTAVE = 4;
+    static constexpr int32_t RE_STEP_BITS = (1 << 23) / RE_CELLS_PER_OCTAVE;        // mantissa bits per cell
+
+    MachReynoldsTable() = default;
+
+    // fn(mach, reynolds) at every grid point covering [minMach, maxMach] x [minReynolds, maxReynolds]
+    template <typename Fn>
+    static MachReynoldsTable sample(float minMach, float maxMach, float minReynolds, float maxReynolds, Fn&& fn)
+    {
+        MachReynoldsTable table;
+        table.m_minMach = minMach;
+        table.m_minReBits = std::bit_cast<int32_t>(minReynolds);
+        table.m_machCells = std::max(1, static_cast<int>(std::ceil((maxMach - minMach) / MACH_STEP)));
+        table.m_reCells = std::max(1, (std::bit_cast<int32_t>(maxReynolds) - table.m_minReBits + RE_STEP_BITS - 1) / RE_STEP_BITS);
+        table.m_machLimit = static_cast<float>(table.m_machCells);
+        table.m_reLimit = static_cast<float>(table.m_reCells);
+
+        // grid points once, then gathered into cells
+        const int columns = table.m_reCells + 1;
+        std::vector<float> points(static_cast<size_t>((table.m_machCells + 1) * columns));
+        for (int i = 0; i <= table.m_machCells; i++)
+        {
+            for (int j = 0; j <= table.m_reCells; j++)
+            {
+                const float mach = minMach + static_cast<float>(i) * MACH_STEP;
+                const float reynolds = std::bit_cast<float>(table.m_minReBits + j * RE_STEP_BITS);
+                points[i * columns + j] = fn(mach, reynolds);
+            }
+        }
+
+        table.m_cells.resize(static_cast<size_t>((table.m_machCells + 1) * columns));
+        for (int i = 0; i <= table.m_machCells; i++)
+        {
+            const int i1 = std::min(i + 1, table.m_machCells);
+            for (int j = 0; j <= table.m_reCells; j++)
+            {
+                const int j1 = std::min(j + 1, table.m_reCells);
+                const float c00 = points[i * columns + j];
+                const float c10 = points[i1 * columns + j];
+                table.m_cells[i * columns + j] = {c00, c10, points[i * columns + j1] - c00, points[i1 * columns + j1] - c10};
+            }
+        }
+        return table;
+    }
+
+    // same grid with every value multiplied by factor
+    MachReynoldsTable scaled(float factor) const
+    {
+        MachReynoldsTable table = *this;
+        for (Cell& cell : table.m_cells)
+        {
+            cell = {cell.low * factor, cell.high * factor, cell.lowSlope * factor, cell.highSlope * factor};
+        }
+        return table;
+    }
+
+    float at(float mach, float reynolds) const
+    {
+        // clamped to [0, cells] with min / max, not branches
+        const float x = std::min(std::max(0.0f, (mach - m_minMach) * (1.0f / MACH_STEP)), m_machLimit);
+        const float y = std::min(std::max(0.0f, static_cast<float>(std::bit_cast<int32_t>(reynolds) - m_minReBits) * (1.0f / RE_STEP_BITS)), m_reLimit);
+
+        const int i = static_cast<int>(x);
+        const int j = static_cast<int>(y);
+        const float tx = x - static_cast<float>(i);
+        const float ty = y - static_cast<float>(j);
+
+        const Cell& cell = m_cells[i * (m_reCells + 1) + j];
+        const float low = cell.low + ty * cell.lowSlope;
+        const float high = cell.high + ty * cell.highSlope;
+        return low + tx * (high - low);
+    }
+
+    bool empty() const { return m_cells.empty(); }
+    size_t cellCount() const { return m_cells.size(); }
+
+private:
+    // values at (i, j) and (i + 1, j), and their change to j + 1
+    struct alignas(16) Cell {
+        float low, high;
+        float lowSlope, highSlope;
+    };
+
+    std::vector<Cell> m_cells;      // mach-major, (machCells + 1) x (reCells + 1) with padding
+    int m_machCells = 0;
+    int m_reCells = 0;
+    float m_machLimit = 0.0f;       // cell counts as float, upper clamp of coordinates
+    float m_reLimit = 0.0f;
+    float m_minMach = 0.0f;
+    int32_t m_minReBits = 0;        // bit pattern of lowest Re
+};
+
+} // namespace drag
+} // namespace forces
+} // namespace dynamics
+} // namespace BulletPhysics
@@ -3,6 +3,8 @@
  */
 
 #include "Coordinates.h"
+#include "math/Transcendental.h"
+
 #include <cmath>
 
 namespace BulletPhysics {
@@ -19,10 +21,10 @@ ECEFPosition geodeticToECEF(const GeographicPosition& geodetic)
     double lon = geodetic.longitude;
     double alt = geodetic.altitude;
 
-    double sinLat = std::sin(lat);
-    double cosLat = std::cos(lat);
-    double sinLon = std::sin(lon);
-    double cosLon = std::cos(lon);
+    double sinLat = math::fp::sin(lat);
+    double cosLat = math::fp::cos(lat);
+    double sinLon = math::fp::sin(lon);
+    double cosLon = math::fp::cos(lon);
 
     // radius of curvature in prime vertical
     double N = constants::EARTH_SEMI_MAJOR_AXIS / std::sqrt(1.0 - constants::EARTH_ECCENTRICITY_SQUARED * sinLat * sinLat);
@@ -41,28 +43,28 @@ GeographicPosition ecefToGeodetic(const ECEFPosition& ecef)
     double y = ecef.y;
     double z = ecef.z;
 
-    double lon = std::atan2(y, x);
+    double lon = math::fp::atan2(y, x);
 
     double p = std::sqrt(x * x + y * y);
-    double lat = std::atan2(z, p * (1.0 - constants::EARTH_ECCENTRICITY_SQUARED));
+    double lat = math::fp::atan2(z, p * (1.0 - constants::EARTH_ECCENTRICITY_SQUARED));
 
     // iterate to improve latitude accuracy
     for (int i = 0; i < 5; i++)
     {
-        double sinLat = std::sin(lat);
+        double sinLat = math::fp::sin(lat);
         double N = constants::EARTH_SEMI_MAJOR_AXIS / std::sqrt(1.0 - constants::EARTH_ECCENTRICITY_SQUARED * sinLat * sinLat);
-        lat = std::atan2(z + constants::EARTH_ECCENTRICITY_SQUARED * N * sinLat, p);
+        lat = math::fp::atan2(z + constants::EARTH_ECCENTRICITY_SQUARED * N * sinLat, p);
     }
 
-    double sinLat = std::sin(lat);
-    double cosLat = std::cos(lat);
+    double sinLat = math::fp::sin(lat);
+    double cosLat = math::fp::cos(lat);
     double N = constants::EARTH_SEMI_MAJOR_AXIS / std::sqrt(1.0 - constants::EARTH_ECCENTRICITY_SQUARED * sinLat * sinLat);
     double alt = p / cosLat - N;
 
     return GeographicPosition(lat, lon, alt);
 }
 
-math::Vec3 ecefToENU(const ECEFPosition& point, const GeographicPosition& reference)
+math::Vec3d ecefToENU(const ECEFPosition& point, const GeographicPosition& reference)
 {
     ECEFPosition refEcef = geodeticToECEF(reference);
 
@@ -70,29 +72,29 @@ math::Vec3 ecefToENU(const ECEFPosition& point, const GeographicPosition& refere
     double dy = point.y - refEcef.y;
     double dz = point.z - refEcef.z;
 
-    double sinLat = std::sin(reference.latitude);
-    double cosLat = std::cos(reference.latitude);
-    double sinLon = std::sin(reference.longitude);
-    double cosLon = std::cos(reference.longitude);
+    double sinLat = math::fp::sin(reference.latitude);
+    double cosLat = math::fp::cos(reference.latitude);
+    double sinLon = math::fp::sin(reference.longitude);
+    double cosLon = math::fp::cos(reference.longitude);
 
     // Rotation matrix from ECEF to ENU
     double east = -sinLon * dx + cosLon * dy;
     double north = -sinLat * cosLon * dx - sinLat * sinLon * dy + cosLat * dz;
     double up = cosLat * cosLon * dx + cosLat * sinLon * dy + sinLat * dz;
 
-    return math::Vec3(static_cast<float>(east), static_cast<float>(up), static_cast<float>(north));
+    return {east, up, north};
 }
 
-ECEFPosition enuToECEF(const math::Vec3& enu, const GeographicPosition& reference)
+ECEFPosition enuToECEF(const math::Vec3d& enu, const GeographicPosition& reference)
 {
     double east = enu.x;
     double up = enu.y;
     double north = enu.z;
 
-    double sinLat = std::sin(reference.latitude);
-    double cosLat = std::cos(reference.latitude);
-    double sinLon = std::sin(reference.longitude);
-    double cosLon = std::cos(reference.longitude);
+    double sinLat = math::fp::sin(reference.latitude);
+    double cosLat = math::fp::cos(reference.latitude);
+    double sinLon = math::fp::sin(reference.longitude);
+    double cosLon = math::fp::cos(reference.longitude);
 
     // inverse rotation matrix from ENU to ECEF
     double dx = -sinLon * east - sinLat * cosLon * north + cosLat * cosLon * up;
@@ -34,8 +34,8 @@ struct ECEFPosition {
 
 ECEFPosition geodeticToECEF(const GeographicPosition& geodetic);                            // convert geodetic (lat, lon, alt) to ECEF (x, y, z)
 GeographicPosition ecefToGeodetic(const ECEFPosition& ecef);                                // convert ECEF (x, y, z) to geodetic (lat, lon, alt)
-math::Vec3 ecefToENU(const ECEFPosition& point, const GeographicPosition& reference);       // convert ECEF (x, y, z) to local ENU (East-North-Up) relative to reference point
-ECEFPosition enuToECEF(const math::Vec3& enu, const GeographicPosition& reference);         // convert local ENU (East-North-Up) to ECEF (x, y, z) relative to reference point
+math::Vec3d ecefToENU(const ECEFPosition& point, const GeographicPosition& reference);      // convert ECEF (x, y, z) to local ENU (East-North-Up) relative to reference point
+ECEFPosition enuToECEF(const math::Vec3d& enu, const GeographicPosition& reference);        // convert local ENU (East-North-Up) to ECEF (x, y, z) relative to reference point
 
 // gravity calculation depend on location
 
@@ -7,14 +7,164 @@
 namespace BulletPhysics {
 namespace math {
 
+namespace {
+
+// translational and rotational state of 6-DOF body, rotation carried as world-frame angular momentum
+// (constant without torque, so fast spin of rifle bullets does not feed the stage error back into itself)
+struct RigidState {
+    Vec3 position;
+    Vec3 velocity;
+    Quat orientation;
+    Vec3 angularMomentum;
+};
+
+// time derivative of RigidState, attitude rate as world-frame angular velocity
+struct RigidRate {
+    Vec3 velocity;
+    Vec3 acceleration;
+    Vec3 angularVelocity;
+    Vec3 torque;
+};
+
+// world-frame L = R * I * R^T * w and back
+Vec3 angularMomentum(const Quat& orientation, const Vec3& inertia, const Vec3& angularVelocity)
+{
+    const Vec3 w = orientation.inverseRotate(angularVelocity);
+    return orientation.rotate({inertia.x * w.x, inertia.y * w.y, inertia.z * w.z});
+}
+
+Vec3 angularVelocity(const Quat& orientation, const Vec3& inertia, const Vec3& angularMomentum)
+{
+    auto divide = [](float value, float moment) { return moment > 0.0f ? value / moment : 0.0f; };
+
+    const Vec3 l = orientation.inverseRotate(angularMomentum);
+    return orientation.rotate({divide(l.x, inertia.x), divide(l.y, inertia.y), divide(l.z, inertia.z)});
+}
+
+// attitude is advanced by exact rotation, linear quaternion steps diverge once spin * h nears 1 rad
+// (rifle bullets spin at 2e4 rad/s)
+RigidState advance(const RigidState& state, const RigidRate& rate, float h)
+{
+    return {
+        state.position + rate.velocity * h,
+        state.velocity + rate.acceleration * h,
+        Quat::fromRotationVector(rate.angularVelocity * h) * state.orientation,
+        state.angularMomentum + rate.torque * h
+    };
+}
+
+// forces and torques on target moved to state, dL/dt = tau (Euler's equations in world frame)
+RigidRate evaluate(dynamics::IPhysicsBody& target, dynamics::PhysicsWorld* world, const std::string& name, const RigidState& state, float dt)
+{
+    dynamics::IRotationalBody& rotational = *target.getRotational();
+
+    const Quat orientation = state.orientation.normalized();
+    const Vec3 omega = angularVelocity(orientation, rotational.getInertia(), state.angularMomentum);
+
+    target.setPosition(state.position);
+    target.setVelocity(state.velocity);
+    rotational.setOrientation(orientation);
+    rotational.setAngularVelocity(omega);
+
+    target.clearForces();
+    rotational.clearTorques();
+
+    if (world)
+    {
+        BULLET_PROFILE_STAGE(world->getProfiler(), name);
+        world->applyForces(target, dt);
+    }
+
+    Vec3 a = {0, 0, 0};
+    if (target.getMass() > 0.0f)
+    {
+        a = target.getAccumulatedForces() / target.getMass();
+    }
+
+    return {state.velocity, a, omega, rotational.getAccumulatedTorques()};
+}
+
+enum class Scheme {
+    Euler,
+    Midpoint,
+    RK4
+};
+
+// 6-DOF step, multi-stage schemes run stages on one scratch clone, attitude is renormalized at the end
+void stepRotational(dynamics::IPhysicsBody& body, dynamics::PhysicsWorld* world, const std::string& name, float dt, Scheme scheme)
+{
+    dynamics::IRotationalBody& rotational = *body.getRotational();
+    const RigidState s0{
+        body.getPosition(),
+        body.getVelocity(),
+        rotational.getOrientation(),
+        angularMomentum(rotational.getOrientation(), rotational.getInertia(), rotational.getAngularVelocity())
+    };
+
+    // Euler evaluates only at current state, so forces go to body itself as in 3-DOF path
+    std::unique_ptr<dynamics::IPhysicsBody> clone = scheme == Scheme::Euler ? nullptr : body.clone();
+    dynamics::IPhysicsBody& scratch = clone ? *clone : body;
+
+    RigidState s;
+    switch (scheme) {
+        case Scheme::Euler:
+        {
+            const RigidRate k1 = evaluate(scratch, world, name, s0, dt);
+            s = advance(s0, k1, dt);
+            break;
+        }
+        case Scheme::Midpoint:
+        {
+            const RigidRate k1 = evaluate(scratch, world, name, s0, dt);
+            const RigidRate k2 = evaluate(scratch, world, name, advance(s0, k1, dt * 0.5f), dt);
+            s = advance(s0, k2, dt);
+            break;
+        }
+        case Scheme::RK4:
+        {
+            const RigidRate k1 = evaluate(scratch, world, name, s0, dt);
+            const RigidRate k2 = evaluate(scratch, world, name, advance(s0, k1, dt * 0.5f), dt);
+            const RigidRate k3 = evaluate(scratch, world, name, advance(s0, k2, dt * 0.5f), dt);
+            const RigidRate k4 = evaluate(scratch, world, name, advance(s0, k3, dt), dt);
+
+            const RigidRate sum{
+                k1.velocity + (k2.velocity + k3.velocity) * 2.0f + k4.velocity,
+                k1.acceleration + (k2.acceleration + k3.acceleration) * 2.0f + k4.acceleration,
+                k1.angularVelocity + (k2.angularVelocity + k3.angularVelocity) * 2.0f + k4.angularVelocity,
+                k1.torque + (k2.torque + k3.torque) * 2.0f + k4.torque
+            };
+            s = advance(s0, sum, dt / 6.0f);
+            break;
+        }
+    }
+
+    body.setPosition(s.position);
+    body.setVelocity(s.velocity);
+    const Quat orientation = s.orientation.normalized();
+    rotational.setOrientation(orientation);
+    rotational.setAngularVelocity(angularVelocity(orientation, rotational.getInertia(), s.angularMomentum));
+    body.clearForces();
+    rotational.clearTorques();
+}
+
+} // namespace
+
 void EulerIntegrator::step(dynamics::IPhysicsBody& body, dynamics::PhysicsWorld* world, float dt)
 {
+    // 6-DOF bodies integrate attitude alongside translation
+    if (body.getRotational())
+    {
+        stepRotational(body, world, m_name, dt, Scheme::Euler);
+        return;
+    }
+
     // clear previous forces
     body.clearForces();
 
     // apply all registered forces
     if (world)
     {
+        BULLET_PROFILE_STAGE(world->getProfiler(), m_name);
         world->applyForces(body, dt);
     }
 
@@ -29,6 +179,12 @@ void EulerIntegrator::step(dynamics::IPhysicsBody& body, dynamics::PhysicsWorld*
     Vec3 v = body.getVelocity() + a * dt;
     Vec3 r = body.getPosition() + body.getVelocity() * dt;
 
+    // projectile spin decays with roll damping
+    if (auto* projectile = body.getProjectile(); projectile && projectile->getAccumulatedSpinAcceleration() != 0.0f)
+    {
+        projectile->setSpinRate(projectile->getSpinRate() + projectile->getAccumulatedSpinAcceleration() * dt);
+    }
+
     body.setPosition(r);
     body.setVelocity(v);
     body.clearForces();
@@ -36,23 +192,42 @@ void EulerIntegrator::step(dynamics::IPhysicsBody& body, dynamics::PhysicsWorld*
 
 void MidpointIntegrator::step(dynamics::IPhysicsBody& body, dynamics::PhysicsWorld* world, float dt)
 {
+    if (body.getRotational())
+    {
+        stepRotational(body, world, m_name, dt, Scheme::Midpoint);
+        return;
+    }
+
     // clear previous forces
     body.clearForces();
 
     const Vec3 r0 = body.getPosition();
     const Vec3 v0 = body.getVelocity();
 
-    // helper lambda to calculate acceleration at given state
-    auto calcAccel = [&](const Vec3& pos, const Vec3& vel) -> Vec3
+    // projectile spin is integrated with translation, stays 0 for plain bodies
+    auto* projectile = body.getProjectile();
+    const float p0 = projectile ? projectile->getSpinRate() : 0.0f;
+
+    // one scratch clone for all stages, each stage overwrites its whole state
+    auto tempBody = body.clone();
+    auto* tempProjectile = tempBody->getProjectile();
+
+    // helper lambda to calculate acceleration and spin acceleration at given state
+    auto calcAccel = [&](const Vec3& pos, const Vec3& vel, float spin, float& outSpinAccel) -> Vec3
     {
         // temporarily set state
-        auto tempBody = body.clone();
         tempBody->setPosition(pos);
         tempBody->setVelocity(vel);
         tempBody->clearForces();
 
+        if (tempProjectile)
+        {
+            tempProjectile->setSpinRate(spin);
+        }
+
         if (world)
         {
+            BULLET_PROFILE_STAGE(world->getProfiler(), m_name);
             world->applyForces(*tempBody, dt);
         }
 
@@ -62,17 +237,20 @@ void MidpointIntegrator::step(dynamics::IPhysicsBody& body, dynamics::PhysicsWor
             a = tempBody->getAccumulatedForces() / tempBody->getMass();
         }
 
+        outSpinAccel = tempProjectile ? tempProjectile->getAccumulatedSpinAcceleration() : 0.0f;
         return a;
     };
 
     // RK2 (Midpoint) steps
-    Vec3 a0 = calcAccel(r0, v0);
+    float s0;
+    Vec3 a0 = calcAccel(r0, v0, p0, s0);
 
     const Vec3 k1_v = a0 * dt;
     const Vec3 k1_r = v0 * dt;
 
     // evaluate at midpoint
-    Vec3 a_mid = calcAccel(r0 + k1_r * 0.5f, v0 + k1_v * 0.5f);
+    float s_mid;
+    Vec3 a_mid = calcAccel(r0 + k1_r * 0.5f, v0 + k1_v * 0.5f, p0 + s0 * dt * 0.5f, s_mid);
     const Vec3 k2_v = a_mid * dt;
     const Vec3 k2_r = (v0 + k1_v * 0.5f) * dt;
 
@@ -80,6 +258,11 @@ void MidpointIntegrator::step(dynamics::IPhysicsBody& body, dynamics::PhysicsWor
     Vec3 v = v0 + k2_v;
     Vec3 r = r0 + k2_r;
 
+    if (projectile && s_mid != 0.0f)
+    {
+        projectile->setSpinRate(p0 + s_mid * dt);
+    }
+
     body.setPosition(r);
     body.setVelocity(v);
     body.clearForces();
@@ -87,23 +270,42 @@ void MidpointIntegrator::step(dynamics::IPhysicsBody& body, dynamics::PhysicsWor
 
 void RK4Integrator::step(dynamics::IPhysicsBody& body, dynamics::PhysicsWorld* world, float dt)
 {
+    if (body.getRotational())
+    {
+        stepRotational(body, world, m_name, dt, Scheme::RK4);
+        return;
+    }
+
     // clear previous forces
     body.clearForces();
 
     const Vec3 r0 = body.getPosition();
     const Vec3 v0 = body.getVelocity();
 
-    // helper lambda to calculate acceleration at given state
-    auto calcAccel = [&](const Vec3& pos, const Vec3& vel) -> Vec3
+    // projectile spin is integrated with translation, stays 0 for plain bodies
+    auto* projectile = body.getProjectile();
+    const float p0 = projectile ? projectile->getSpinRate() : 0.0f;
+
+    // one scratch clone for all stages, each stage overwrites its whole state
+    auto tempBody = body.clone();
+    auto* tempProjectile = tempBody->getProjectile();
+
+    // helper lambda to calculate acceleration and spin acceleration at given state
+    auto calcAccel = [&](const Vec3& pos, const Vec3& vel, float spin, float& outSpinAccel) -> Vec3
     {
         // temporarily set state
-        auto tempBody = body.clone();
         tempBody->setPosition(pos);
         tempBody->setVelocity(vel);
         tempBody->clearForces();
 
+        if (tempProjectile)
+        {
+            tempProjectile->setSpinRate(spin);
+        }
+
         if (world)
         {
+            BULLET_PROFILE_STAGE(world->getProfiler(), m_name);
             world->applyForces(*tempBody, dt);
         }
 
@@ -113,24 +315,29 @@ void RK4Integrator::step(dynamics::IPhysicsBody& body, dynamics::PhysicsWorld* w
             a = tempBody->getAccumulatedForces() / tempBody->getMass();
         }
 
+        outSpinAccel = tempProjectile ? tempProjectile->getAccumulatedSpinAcceleration() : 0.0f;
         return a;
     };
 
     // RK4 steps
-    Vec3 a0 = calcAccel(r0, v0);
+    float s0;
+    Vec3 a0 = calcAccel(r0, v0, p0, s0);
 
     const Vec3 k1_v = a0 * dt;
     const Vec3 k1_r = v0 * dt;
 
-    Vec3 a1 = calcAccel(r0 + k1_r * 0.5f, v0 + k1_v * 0.5f);
+    float s1;
+    Vec3 a1 = calcAccel(r0 + k1_r * 0.5f, v0 + k1_v * 0.5f, p0 + s0 * dt * 0.5f, s1);
     const Vec3 k2_v = a1 * dt;
     const Vec3 k2_r = (v0 + k1_v * 0.5f) * dt;
 
-    Vec3 a2 = calcAccel(r0 + k2_r * 0.5f, v0 + k2_v * 0.5f);
+    float s2;
+    Vec3 a2 = calcAccel(r0 + k2_r * 0.5f, v0 + k2_v * 0.5f, p0 + s1 * dt * 0.5f, s2);
     const Vec3 k3_v = a2 * dt;
     const Vec3 k3_r = (v0 + k2_v * 0.5f) * dt;
 
-    Vec3 a3 = calcAccel(r0 + k3_r, v0 + k3_v);
+    float s3;
+    Vec3 a3 = calcAccel(r0 + k3_r, v0 + k3_v, p0 + s2 * dt, s3);
     const Vec3 k4_v = a3 * dt;
     const Vec3 k4_r = (v0 + k3_v) * dt;
 
@@ -138,6 +345,12 @@ void RK4Integrator::step(dynamics::IPhysicsBody& body, dynamics::PhysicsWorld* w
     Vec3 v = v0 + (k1_v + k2_v * 2.0f + k3_v * 2.0f + k4_v) * (1.0f / 6.0f);
     Vec3 r = r0 + (k1_r + k2_r * 2.0f + k3_r * 2.0f + k4_r) * (1.0f / 6.0f);
 
+    const float spinDelta = (s0 + s1 * 2.0f + s2 * 2.0f + s3) * (dt / 6.0f);
+    if (projectile && spinDelta != 0.0f)
+    {
+        projectile->setSpinRate(p0 + spinDelta);
+    }
+
     body.setPosition(r);
     body.setVelocity(v);
     body.clearForces();
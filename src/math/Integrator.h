@@ -7,6 +7,8 @@
 #include "dynamics/PhysicsBody.h"
 #include "dynamics/PhysicsWorld.h"
 
+#include <string>
+
 namespace BulletPhysics {
 namespace math {
 
@@ -14,21 +16,38 @@ class IIntegrator {
 public:
     virtual ~IIntegrator() = default;
     virtual void step(dynamics::IPhysicsBody& body, dynamics::PhysicsWorld* world, float dt) = 0;
+
+    virtual const std::string& getName() const = 0;
 };
 
 class EulerIntegrator final : public IIntegrator {
 public:
     void step(dynamics::IPhysicsBody& body, dynamics::PhysicsWorld* world, float dt) override;
+
+    const std::string& getName() const override { return m_name; }
+
+private:
+    std::string m_name = "Euler";
 };
 
 class MidpointIntegrator final : public IIntegrator {
 public:
     void step(dynamics::IPhysicsBody& body, dynamics::PhysicsWorld* world, float dt) override;
+
+    const std::string& getName() const override { return m_name; }
+
+private:
+    std::string m_name = "Midpoint";
 };
 
 class RK4Integrator final : public IIntegrator {
 public:
     void step(dynamics::IPhysicsBody& body, dynamics::PhysicsWorld* world, float dt) override;
+
+    const std::string& getName() const override { return m_name; }
+
+private:
+    std::string m_name = "RK4";
 };
 
 } // namespace math
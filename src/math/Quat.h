@@ -0,0 +1,142 @@
+/*
+ * Quat.h
+ */
+
+#pragma once
+
+#include "Vec3.h"
+
+#include "Constants.h"
+#include "Transcendental.h"
+
+#include <cmath>
+
+namespace BulletPhysics {
+namespace math {
+
+// unit quaternion for body attitude, rotates body frame into world frame
+struct Quat {
+    float w, x, y, z;
+
+    Quat();
+    Quat(float W, float X, float Y, float Z);
+
+    static Quat fromAxisAngle(const Vec3& axis, float angle);
+
+    // rotation by |r| around r (exponential map), identity for zero vector
+    static Quat fromRotationVector(const Vec3& rotation);
+
+    // shortest rotation taking unit vector from onto unit vector to
+    static Quat fromTo(const Vec3& from, const Vec3& to);
+
+    Quat operator*(const Quat& rhs) const;
+    Quat operator+(const Quat& rhs) const;
+    Quat operator*(float scalar) const;
+
+    Quat conjugate() const;
+    float length() const;
+    Quat normalized() const;
+
+    // rotate vector from body frame to world frame (and back with inverse)
+    Vec3 rotate(const Vec3& v) const;
+    Vec3 inverseRotate(const Vec3& v) const;
+
+    // time derivative under world-frame angular velocity: dq/dt = 0.5 * (0, omega) * q
+    Quat derivative(const Vec3& omega) const;
+};
+
+inline Quat::Quat() : w(1.0f), x(0.0f), y(0.0f), z(0.0f) {}
+inline Quat::Quat(float W, float X, float Y, float Z) : w(W), x(X), y(Y), z(Z) {}
+
+inline Quat Quat::fromAxisAngle(const Vec3& axis, float angle)
+{
+    Vec3 n = axis.normalized();
+    float s = fp::sin(angle * 0.5f);
+    return {fp::cos(angle * 0.5f), n.x * s, n.y * s, n.z * s};
+}
+
+inline Quat Quat::fromRotationVector(const Vec3& rotation)
+{
+    float angle = rotation.length();
+    if (angle < 1e-12f)
+    {
+        return {};
+    }
+
+    float s = fp::sin(angle * 0.5f) / angle;
+    return {fp::cos(angle * 0.5f), rotation.x * s, rotation.y * s, rotation.z * s};
+}
+
+inline Quat Quat::fromTo(const Vec3& from, const Vec3& to)
+{
+    float d = from.dot(to);
+
+    // opposite vectors: half turn around any perpendicular axis
+    if (d < -0.9999f)
+    {
+        Vec3 axis = from.cross(std::abs(from.x) < 0.9f ? Vec3{1.0f, 0.0f, 0.0f} : Vec3{0.0f, 1.0f, 0.0f});
+        return fromAxisAngle(axis, constants::PI);
+    }
+
+    Vec3 c = from.cross(to);
+    return Quat{1.0f + d, c.x, c.y, c.z}.normalized();
+}
+
+inline Quat Quat::operator*(const Quat& rhs) const
+{
+    return {
+        w * rhs.w - x * rhs.x - y * rhs.y - z * rhs.z,
+        w * rhs.x + x * rhs.w + y * rhs.z - z * rhs.y,
+        w * rhs.y - x * rhs.z + y * rhs.w + z * rhs.x,
+        w * rhs.z + x * rhs.y - y * rhs.x + z * rhs.w
+    };
+}
+inline Quat Quat::operator+(const Quat& rhs) const
+{
+    return {w + rhs.w, x + rhs.x, y + rhs.y, z + rhs.z};
+}
+inline Quat Quat::operator*(float scalar) const
+{
+    return {w * scalar, x * scalar, y * scalar, z * scalar};
+}
+
+inline Quat Quat::conjugate() const
+{
+    return {w, -x, -y, -z};
+}
+
+inline float Quat::length() const
+{
+    return std::sqrt(w * w + x * x + y * y + z * z);
+}
+
+inline Quat Quat::normalized() const
+{
+    float len = length();
+    if (len > 0.0001f)
+    {
+        return *this * (1.0f / len);
+    }
+    return {};
+}
+
+inline Vec3 Quat::rotate(const Vec3& v) const
+{
+    // v' = v + 2 * q_v x (q_v x v + w * v)
+    Vec3 u{x, y, z};
+    Vec3 t = u.cross(v) * 2.0f;
+    return v + t * w + u.cross(t);
+}
+
+inline Vec3 Quat::inverseRotate(const Vec3& v) const
+{
+    return conjugate().rotate(v);
+}
+
+inline Quat Quat::derivative(const Vec3& omega) const
+{
+    return Quat{0.0f, omega.x, omega.y, omega.z} * *this * 0.5f;
+}
+
+} // namespace math
+} // namespace BulletPhysics
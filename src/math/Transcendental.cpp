@@ -0,0 +1,297 @@
+/*
+ * Transcendental.cpp
+ */
+
+#include "Transcendental.h"
+
+#include <limits>
+
+namespace BulletPhysics {
+namespace math {
+namespace portable {
+
+namespace {
+
+// ln(2) and pi/2 split so that k * HI is exact for moderate k (Cody-Waite reduction, fdlibm constants)
+constexpr double LN2_HI = 6.93147180369123816490e-01;
+constexpr double LN2_LO = 1.90821492927058770002e-10;
+constexpr double INV_LN2 = 1.44269504088896338700e+00;
+
+constexpr double PIO2_1 = 1.57079632673412561417e+00;
+constexpr double PIO2_2 = 6.07710050630396597660e-11;
+constexpr double PIO2_3 = 2.02226624871116645580e-21;
+constexpr double PIO2_3T = 8.47842766036889956997e-32;
+constexpr double INV_PIO2 = 6.36619772367581382433e-01;
+
+constexpr double PI = 3.14159265358979311600e+00;
+constexpr double PIO2 = 1.57079632679489655800e+00;
+
+constexpr double EXP_OVERFLOW = 709.782712893383973096;
+constexpr double EXP_UNDERFLOW = -745.133219101941108420;
+
+// Taylor series on reduced range, Horner form; coefficients folded at compile time
+// exp(r) for |r| <= ln(2) / 2
+double expReduced(double r)
+{
+    double p = 1.0 / 6227020800.0;          // 1/13!
+    p = p * r + 1.0 / 479001600.0;
+    p = p * r + 1.0 / 39916800.0;
+    p = p * r + 1.0 / 3628800.0;
+    p = p * r + 1.0 / 362880.0;
+    p = p * r + 1.0 / 40320.0;
+    p = p * r + 1.0 / 5040.0;
+    p = p * r + 1.0 / 720.0;
+    p = p * r + 1.0 / 120.0;
+    p = p * r + 1.0 / 24.0;
+    p = p * r + 1.0 / 6.0;
+    p = p * r + 0.5;
+    return 1.0 + r + r * r * p;
+}
+
+// sin(r) and cos(r) for |r| <= pi/4
+double sinReduced(double r)
+{
+    const double r2 = r * r;
+    double p = -1.0 / 355687428096000.0;    // -1/17!
+    p = p * r2 + 1.0 / 1307674368000.0;
+    p = p * r2 - 1.0 / 6227020800.0;
+    p = p * r2 + 1.0 / 39916800.0;
+    p = p * r2 - 1.0 / 362880.0;
+    p = p * r2 + 1.0 / 5040.0;
+    p = p * r2 - 1.0 / 120.0;
+    p = p * r2 + 1.0 / 6.0;
+    return r - r * r2 * p;
+}
+
+double cosReduced(double r)
+{
+    const double r2 = r * r;
+    double p = 1.0 / 6402373705728000.0;    // 1/18!
+    p = p * r2 - 1.0 / 20922789888000.0;
+    p = p * r2 + 1.0 / 87178291200.0;
+    p = p * r2 - 1.0 / 479001600.0;
+    p = p * r2 + 1.0 / 3628800.0;
+    p = p * r2 - 1.0 / 40320.0;
+    p = p * r2 + 1.0 / 720.0;
+    p = p * r2 - 1.0 / 24.0;
+    p = p * r2 + 0.5;
+    return 1.0 - r2 * p;
+}
+
+// atan(x) for |x| <= 1: two halvings atan(x) = 2 * atan(x / (1 + sqrt(1 + x^2))) bring |x| below tan(pi/16) ~ 0.2,
+// where odd series converges in 13 terms
+double atanReduced(double x)
+{
+    x = x / (1.0 + std::sqrt(1.0 + x * x));
+    x = x / (1.0 + std::sqrt(1.0 + x * x));
+
+    const double x2 = x * x;
+    double p = 1.0 / 25.0;
+    p = p * x2 - 1.0 / 23.0;
+    p = p * x2 + 1.0 / 21.0;
+    p = p * x2 - 1.0 / 19.0;
+    p = p * x2 + 1.0 / 17.0;
+    p = p * x2 - 1.0 / 15.0;
+    p = p * x2 + 1.0 / 13.0;
+    p = p * x2 - 1.0 / 11.0;
+    p = p * x2 + 1.0 / 9.0;
+    p = p * x2 - 1.0 / 7.0;
+    p = p * x2 + 1.0 / 5.0;
+    p = p * x2 - 1.0 / 3.0;
+    return 4.0 * (x + x * x2 * p);
+}
+
+// x = k * pi/2 + r, returns quadrant k mod 4; precise while |k| stays below 2^20
+int reduceQuadrant(double x, double& r)
+{
+    const double k = std::floor(x * INV_PIO2 + 0.5);
+    r = ((x - k * PIO2_1) - k * PIO2_2) - (k * PIO2_3 + k * PIO2_3T);
+    return static_cast<int>(k - 4.0 * std::floor(k * 0.25));
+}
+
+} // namespace
+
+double exp(double x)
+{
+    if (std::isnan(x))
+    {
+        return x;
+    }
+    if (x > EXP_OVERFLOW)
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+    if (x < EXP_UNDERFLOW)
+    {
+        return 0.0;
+    }
+
+    // x = k * ln2 + r, exp(x) = 2^k * exp(r)
+    const double k = std::floor(x * INV_LN2 + 0.5);
+    const double r = (x - k * LN2_HI) - k * LN2_LO;
+    return std::ldexp(expReduced(r), static_cast<int>(k));
+}
+
+double log(double x)
+{
+    if (std::isnan(x) || x < 0.0)
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    if (x == 0.0)
+    {
+        return -std::numeric_limits<double>::infinity();
+    }
+    if (std::isinf(x))
+    {
+        return x;
+    }
+
+    // x = m * 2^e with m in [sqrt(1/2), sqrt(2))
+    int e;
+    double m = std::frexp(x, &e);
+    if (m < 0.70710678118654752440)
+    {
+        m *= 2.0;
+        e--;
+    }
+
+    // log(m) = 2 * atanh(s), s = (m - 1) / (m + 1), |s| < 0.172
+    const double f = m - 1.0;
+    const double s = f / (2.0 + f);
+    const double s2 = s * s;
+    double p = 1.0 / 21.0;
+    p = p * s2 + 1.0 / 19.0;
+    p = p * s2 + 1.0 / 17.0;
+    p = p * s2 + 1.0 / 15.0;
+    p = p * s2 + 1.0 / 13.0;
+    p = p * s2 + 1.0 / 11.0;
+    p = p * s2 + 1.0 / 9.0;
+    p = p * s2 + 1.0 / 7.0;
+    p = p * s2 + 1.0 / 5.0;
+    p = p * s2 + 1.0 / 3.0;
+
+    const double ek = static_cast<double>(e);
+    return ek * LN2_HI + ((f - s * (f - 2.0 * s2 * p)) + ek * LN2_LO);
+}
+
+double log1p(double x)
+{
+    // 1 + x rounds away low bits of small x, log(u) * x / (u - 1) puts them back (u - 1 is exact)
+    const double u = 1.0 + x;
+    if (u == 1.0)
+    {
+        return x;
+    }
+    if (std::isinf(u) || u <= 0.0)
+    {
+        return log(u);
+    }
+    return log(u) * (x / (u - 1.0));
+}
+
+double pow(double base, double exponent)
+{
+    if (exponent == 0.0)
+    {
+        return 1.0;
+    }
+    if (base == 1.0)
+    {
+        return 1.0;
+    }
+
+    if (base < 0.0)
+    {
+        // only integer exponents have real result
+        if (std::floor(exponent) != exponent)
+        {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        const double magnitude = pow(-base, exponent);
+        return std::fmod(exponent, 2.0) != 0.0 ? -magnitude : magnitude;
+    }
+    if (base == 0.0)
+    {
+        return exponent > 0.0 ? 0.0 : std::numeric_limits<double>::infinity();
+    }
+
+    return exp(exponent * log(base));
+}
+
+double sin(double x)
+{
+    if (!std::isfinite(x))
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    double r;
+    switch (reduceQuadrant(x, r)) {
+        case 0: return sinReduced(r);
+        case 1: return cosReduced(r);
+        case 2: return -sinReduced(r);
+        default: return -cosReduced(r);
+    }
+}
+
+double cos(double x)
+{
+    if (!std::isfinite(x))
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    double r;
+    switch (reduceQuadrant(x, r)) {
+        case 0: return cosReduced(r);
+        case 1: return -sinReduced(r);
+        case 2: return -cosReduced(r);
+        default: return sinReduced(r);
+    }
+}
+
+double asin(double x)
+{
+    if (std::isnan(x) || std::abs(x) > 1.0)
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    return atan2(x, std::sqrt((1.0 - x) * (1.0 + x)));
+}
+
+double atan2(double y, double x)
+{
+    if (std::isnan(x) || std::isnan(y))
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    if (y == 0.0)
+    {
+        // keeps sign of zero y, pi for negative x
+        return std::signbit(x) ? std::copysign(PI, y) : y;
+    }
+    if (std::isinf(x) || std::isinf(y))
+    {
+        if (std::isinf(x) && std::isinf(y))
+        {
+            return std::copysign(std::signbit(x) ? 3.0 * PIO2 / 2.0 : PIO2 / 2.0, y);
+        }
+        if (std::isinf(y))
+        {
+            return std::copysign(PIO2, y);
+        }
+        return std::signbit(x) ? std::copysign(PI, y) : std::copysign(0.0, y);
+    }
+
+    // angle of (|x|, |y|) in first quadrant, then mirrored
+    const double ax = std::abs(x);
+    const double ay = std::abs(y);
+    const double angle = ay <= ax ? atanReduced(ay / ax) : PIO2 - atanReduced(ax / ay);
+    const double full = std::signbit(x) ? PI - angle : angle;
+    return std::copysign(full, y);
+}
+
+} // namespace portable
+} // namespace math
+} // namespace BulletPhysics
@@ -0,0 +1,64 @@
+/*
+ * Transcendental.h
+ */
+
+#pragma once
+
+#include <cmath>
+
+namespace BulletPhysics {
+namespace math {
+
+// library implementations built only from +, -, *, / and sqrt (all correctly rounded by IEEE 754),
+// so results are bit-identical on every compiler and libm given same FP flags; about 1 ulp in double
+// (pow loses a few more bits for large exponent * log(base), asin and atan2 a few through argument halving),
+// float overloads evaluate in double and round once
+namespace portable {
+
+double exp(double x);
+double log(double x);
+double log1p(double x);
+double pow(double base, double exponent);
+double sin(double x);
+double cos(double x);
+double asin(double x);
+double atan2(double y, double x);
+
+inline float exp(float x) { return static_cast<float>(exp(static_cast<double>(x))); }
+inline float log(float x) { return static_cast<float>(log(static_cast<double>(x))); }
+inline float log1p(float x) { return static_cast<float>(log1p(static_cast<double>(x))); }
+inline float pow(float base, float exponent) { return static_cast<float>(pow(static_cast<double>(base), static_cast<double>(exponent))); }
+inline float sin(float x) { return static_cast<float>(sin(static_cast<double>(x))); }
+inline float cos(float x) { return static_cast<float>(cos(static_cast<double>(x))); }
+inline float asin(float x) { return static_cast<float>(asin(static_cast<double>(x))); }
+inline float atan2(float y, float x) { return static_cast<float>(atan2(static_cast<double>(y), static_cast<double>(x))); }
+
+} // namespace portable
+
+// functions used by simulation hot path: portable versions in deterministic builds, std otherwise
+namespace fp {
+
+#ifdef BULLET_PHYSICS_DETERMINISTIC
+using portable::exp;
+using portable::log;
+using portable::log1p;
+using portable::pow;
+using portable::sin;
+using portable::cos;
+using portable::asin;
+using portable::atan2;
+#else
+using std::exp;
+using std::log;
+using std::log1p;
+using std::pow;
+using std::sin;
+using std::cos;
+using std::asin;
+using std::atan2;
+#endif
+
+} // namespace fp
+
+} // namespace math
+} // namespace BulletPhysics
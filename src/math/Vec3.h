@@ -4,31 +4,143 @@
 
 #pragma once
 
+#include <cmath>
+#include <type_traits>
+
 namespace BulletPhysics {
 namespace math {
 
-struct Vec3 {
-    float x, y, z;
+// 3-component vector over scalar type, float for game-rate simulation, double for long-range fire control
+template <typename T>
+struct Vec3T {
+    using Scalar = T;
+
+    T x, y, z;
 
-    Vec3();
-    Vec3(float X, float Y, float Z);
+    Vec3T();
+    Vec3T(T X, T Y, T Z);
 
-    Vec3 operator+(const Vec3& rhs) const;
-    Vec3 operator-(const Vec3& rhs) const;
-    Vec3 operator*(float scalar) const;
-    Vec3 operator/(float scalar) const;
+    // between precisions, explicit so narrowing is visible
+    template <typename U>
+    explicit Vec3T(const Vec3T<U>& other);
 
-    Vec3& operator+=(const Vec3& rhs);
-    Vec3& operator-=(const Vec3& rhs);
-    Vec3& operator*=(float scalar);
+    Vec3T operator+(const Vec3T& rhs) const;
+    Vec3T operator-(const Vec3T& rhs) const;
+    Vec3T operator*(T scalar) const;
+    Vec3T operator/(T scalar) const;
 
-    float length() const;
-    Vec3 normalized() const;
-    float dot(const Vec3& rhs) const;
-    Vec3 cross(const Vec3& rhs) const;
+    Vec3T& operator+=(const Vec3T& rhs);
+    Vec3T& operator-=(const Vec3T& rhs);
+    Vec3T& operator*=(T scalar);
+
+    T length() const;
+    Vec3T normalized() const;
+    T dot(const Vec3T& rhs) const;
+    Vec3T cross(const Vec3T& rhs) const;
 };
 
-Vec3 operator*(float scalar, const Vec3& vec);
+using Vec3 = Vec3T<float>;
+using Vec3d = Vec3T<double>;
+
+// scalar not deduced, so 2.0f * Vec3d and 2.0 * Vec3 both convert scalar to vector precision
+template <typename T>
+Vec3T<T> operator*(std::type_identity_t<T> scalar, const Vec3T<T>& vec);
+
+// defined inline, called from every hot loop (bounds refresh, narrowphase, force evaluation)
+
+template <typename T>
+inline Vec3T<T>::Vec3T() : x(0), y(0), z(0) {}
+template <typename T>
+inline Vec3T<T>::Vec3T(T X, T Y, T Z) : x(X), y(Y), z(Z) {}
+
+template <typename T>
+template <typename U>
+inline Vec3T<T>::Vec3T(const Vec3T<U>& other) : x(static_cast<T>(other.x)), y(static_cast<T>(other.y)), z(static_cast<T>(other.z)) {}
+
+template <typename T>
+inline Vec3T<T> Vec3T<T>::operator+(const Vec3T& rhs) const
+{
+    return {x + rhs.x, y + rhs.y, z + rhs.z};
+}
+template <typename T>
+inline Vec3T<T> Vec3T<T>::operator-(const Vec3T& rhs) const
+{
+    return {x - rhs.x, y - rhs.y, z - rhs.z};
+}
+template <typename T>
+inline Vec3T<T> Vec3T<T>::operator*(T scalar) const
+{
+    return {x * scalar, y * scalar, z * scalar};
+}
+template <typename T>
+inline Vec3T<T> Vec3T<T>::operator/(T scalar) const
+{
+    return {x / scalar, y / scalar, z / scalar};
+}
+
+template <typename T>
+inline Vec3T<T>& Vec3T<T>::operator+=(const Vec3T& rhs)
+{
+    x += rhs.x;
+    y += rhs.y;
+    z += rhs.z;
+    return *this;
+}
+template <typename T>
+inline Vec3T<T>& Vec3T<T>::operator-=(const Vec3T& rhs)
+{
+    x -= rhs.x;
+    y -= rhs.y;
+    z -= rhs.z;
+    return *this;
+}
+template <typename T>
+inline Vec3T<T>& Vec3T<T>::operator*=(T scalar)
+{
+    x *= scalar;
+    y *= scalar;
+    z *= scalar;
+    return *this;
+}
+
+template <typename T>
+inline Vec3T<T> operator*(std::type_identity_t<T> scalar, const Vec3T<T>& vec)
+{
+    return vec * scalar;
+}
+
+template <typename T>
+inline T Vec3T<T>::length() const
+{
+    return std::sqrt(x * x + y * y + z * z);
+}
+
+template <typename T>
+inline Vec3T<T> Vec3T<T>::normalized() const
+{
+    T len = length();
+    if (len > T(0.0001))
+    {
+        return *this / len;
+    }
+    return {0, 0, 0};
+}
+
+template <typename T>
+inline T Vec3T<T>::dot(const Vec3T& rhs) const
+{
+    return x * rhs.x + y * rhs.y + z * rhs.z;
+}
+
+template <typename T>
+inline Vec3T<T> Vec3T<T>::cross(const Vec3T& rhs) const
+{
+    return {
+        y * rhs.z - z * rhs.y,
+        z * rhs.x - x * rhs.z,
+        x * rhs.y - y * rhs.x
+    };
+}
 
 } // namespace math
 } // namespace BulletPhysics
@@ -0,0 +1,183 @@
+/*
+ * BallisticTest.cpp
+ */
+
+#include "dynamics/ProjectileStore.h"
+#include "dynamics/Simulation.h"
+#include "dynamics/forces/Gravity.h"
+#include "dynamics/forces/drag/Drag.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace BulletPhysics;
+using namespace BulletPhysics::dynamics;
+
+namespace {
+
+constexpr float GRAIN = 6.479891e-5f;       // kg
+constexpr float FPS = 0.3048f;              // m/s
+constexpr float YARD = 0.9144f;             // m
+
+// Sierra 175 gr .308 MatchKing, G7 BC 0.243
+projectile::ProjectileSpecs matchKing175()
+{
+    projectile::ProjectileSpecs specs{175.0f * GRAIN};
+    specs.diameter = 0.00782f;
+    specs.dragModel = forces::drag::DragCurveModel::G7;
+    specs.ballisticCoefficients = {{0.243f}};
+    return specs;
+}
+
+// Sierra 168 gr .308 MatchKing, banded G1 BCs 0.462 above 2600 fps, 0.447 above 1800 fps, 0.424 below
+projectile::ProjectileSpecs matchKing168()
+{
+    projectile::ProjectileSpecs specs{168.0f * GRAIN};
+    specs.diameter = 0.00782f;
+    specs.ballisticCoefficients = {{0.424f, 0.0f}, {0.447f, 1800.0f * FPS}, {0.462f, 2600.0f * FPS}};
+    return specs;
+}
+
+struct RangePoint {
+    double drop;        // m below line of departure
+    double speed;       // m/s
+};
+
+// point-mass solution straight from standard curve and published BCs: double precision RK4 with fine step,
+// band chosen by speed, ICAO sea-level air
+std::vector<RangePoint> referenceTrajectory(const projectile::ProjectileSpecs& specs, forces::drag::DragCurveModel model, double muzzleVelocity,
+                                            const std::vector<double>& ranges)
+{
+    const forces::drag::StandardDragModel curve(model);
+    const double rho = constants::BASE_ATMOSPHERIC_DENSITY;
+    const double c = constants::BASE_SPEED_OF_SOUND;
+    const double g = -constants::GRAVITY.y;
+
+    const auto acceleration = [&](double vx, double vy, double& ax, double& ay)
+    {
+        const double speed = std::sqrt(vx * vx + vy * vy);
+        double bc = specs.ballisticCoefficients.front().value;
+        for (const projectile::BallisticCoefficient& band : specs.ballisticCoefficients)
+        {
+            if (band.minVelocity <= speed)
+            {
+                bc = band.value;
+            }
+        }
+
+        // C_d * S = C_d_standard * pi * m / (4 * BC)
+        const double dragArea = curve.getCd(static_cast<float>(speed / c)) * math::constants::PI * specs.mass / (4.0 * bc * constants::LB_PER_IN2_TO_KG_PER_M2);
+        const double k = 0.5 * rho * dragArea * speed / specs.mass;
+        ax = -k * vx;
+        ay = -k * vy - g;
+    };
+
+    constexpr double dt = 1e-5;
+    double x = 0.0, y = 0.0, vx = muzzleVelocity, vy = 0.0;
+
+    std::vector<RangePoint> points;
+    for (double range : ranges)
+    {
+        while (x < range)
+        {
+            double ax1, ay1, ax2, ay2, ax3, ay3, ax4, ay4;
+            acceleration(vx, vy, ax1, ay1);
+            acceleration(vx + 0.5 * dt * ax1, vy + 0.5 * dt * ay1, ax2, ay2);
+            acceleration(vx + 0.5 * dt * ax2, vy + 0.5 * dt * ay2, ax3, ay3);
+            acceleration(vx + dt * ax3, vy + dt * ay3, ax4, ay4);
+
+            x += dt * (vx + dt / 6.0 * (ax1 + ax2 + ax3));
+            y += dt * (vy + dt / 6.0 * (ay1 + ay2 + ay3));
+            vx += dt / 6.0 * (ax1 + 2.0 * ax2 + 2.0 * ax3 + ax4);
+            vy += dt / 6.0 * (ay1 + 2.0 * ay2 + 2.0 * ay3 + ay4);
+        }
+        points.push_back({-y, std::sqrt(vx * vx + vy * vy)});
+    }
+    return points;
+}
+
+// same shot through simulation with gravity and drag, drop and speed where body first passes each range
+std::vector<RangePoint> simulatedTrajectory(const projectile::ProjectileSpecs& specs, float muzzleVelocity, const std::vector<double>& ranges)
+{
+    Simulation simulation(1.0f / 1000.0f);
+    simulation.getWorld().addForce(std::make_unique<forces::Gravity>());
+    simulation.getWorld().addForce(std::make_unique<forces::drag::Drag>());
+
+    projectile::ProjectileRigidBody body(specs);
+    body.setVelocity({muzzleVelocity, 0.0f, 0.0f});
+    const auto handle = simulation.spawn<projectile::ProjectileRigidBody>(std::move(body));
+
+    std::vector<RangePoint> points;
+    for (double range : ranges)
+    {
+        while (simulation.getBodies().get(handle)->getPosition().x < range)
+        {
+            simulation.tick();
+        }
+
+        const auto& state = *simulation.getBodies().get(handle);
+        points.push_back({-state.getPosition().y, state.getVelocity().length()});
+    }
+    return points;
+}
+
+void expectMatchesReference(const projectile::ProjectileSpecs& specs, forces::drag::DragCurveModel model, float muzzleVelocity)
+{
+    const std::vector<double> ranges = {300.0 * YARD, 600.0 * YARD, 1000.0 * YARD};
+    const std::vector<RangePoint> reference = referenceTrajectory(specs, model, muzzleVelocity, ranges);
+    const std::vector<RangePoint> simulated = simulatedTrajectory(specs, muzzleVelocity, ranges);
+
+    for (size_t i = 0; i < ranges.size(); i++)
+    {
+        // simulation stops at first tick past range (under 1 m at these speeds), which adds about v_y * dt of drop
+        EXPECT_NEAR(simulated[i].speed, reference[i].speed, 0.005 * reference[i].speed) << "at " << ranges[i] / YARD << " yd";
+        EXPECT_NEAR(simulated[i].drop, reference[i].drop, 0.01 * reference[i].drop + 0.01) << "at " << ranges[i] / YARD << " yd";
+    }
+}
+
+} // namespace
+
+TEST(Ballistic, G7LoadMatchesPointMassReference)
+{
+    expectMatchesReference(matchKing175(), forces::drag::DragCurveModel::G7, 2600.0f * FPS);
+}
+
+TEST(Ballistic, BandedG1LoadMatchesPointMassReference)
+{
+    expectMatchesReference(matchKing168(), forces::drag::DragCurveModel::G1, 2650.0f * FPS);
+}
+
+// band follows air speed: in cold air same speed is higher Mach, band must not move with it
+TEST(Ballistic, BandChosenByVelocityNotMach)
+{
+    projectile::ProjectileStore store;
+    const projectile::ProjectileLoad& load = store.intern(matchKing168());
+    const forces::drag::StandardDragModel g1(forces::drag::DragCurveModel::G1);
+
+    const float speed = 540.0f;                 // below 1800 fps band
+    const float coldMach = speed / 320.0f;      // about -18 C
+
+    const float expected = g1.getCd(coldMach) * math::constants::PI * load.mass / (4.0f * 0.424f * constants::LB_PER_IN2_TO_KG_PER_M2);
+    EXPECT_NEAR(load.dragAreaAt(coldMach, speed), expected, 1e-3f * expected);
+}
+
+// custom model without its curve file keeps BCs, which then refer to G1 as for unset model
+TEST(Ballistic, CustomModelWithoutFileFallsBackToG1)
+{
+    projectile::ProjectileStore store;
+    projectile::ProjectileSpecs custom = matchKing168();
+    custom.dragModel = forces::drag::DragCurveModel::CUSTOM;
+
+    const projectile::ProjectileLoad& fallback = store.intern(custom);
+    const projectile::ProjectileLoad& g1 = store.intern(matchKing168());
+
+    ASSERT_NE(fallback.dragModel, nullptr);
+    for (float speed : {300.0f, 600.0f, 850.0f})
+    {
+        const float mach = speed / constants::BASE_SPEED_OF_SOUND;
+        EXPECT_EQ(fallback.dragAreaAt(mach, speed), g1.dragAreaAt(mach, speed)) << speed << " m/s";
+    }
+}
@@ -0,0 +1,113 @@
+/*
+ * DeterminismTest.cpp
+ */
+
+#include "BenchmarkWorlds.h"
+#include "dynamics/Simulation.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+
+using namespace BulletPhysics;
+using namespace BulletPhysics::dynamics;
+
+namespace {
+
+constexpr float TICK = 1.0f / 240.0f;
+constexpr int TICKS = 480;      // 2 s
+
+#ifdef BULLET_PHYSICS_DETERMINISTIC
+constexpr bool DETERMINISTIC = true;
+#else
+constexpr bool DETERMINISTIC = false;
+#endif
+
+// state hashes of deterministic build, same bits expected from every compiler and platform;
+// any change to integration, forces or environments of full world changes them
+constexpr uint64_t GOLDEN_3DOF = 0x46f499a094c2524eull;
+constexpr uint64_t GOLDEN_6DOF = 0xf75332deb370627cull;
+
+// FNV-1a over float bit patterns
+class StateHash {
+public:
+    void add(float value)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        for (int i = 0; i < 4; i++)
+        {
+            m_value = (m_value ^ ((bits >> (8 * i)) & 0xFF)) * 1099511628211ull;
+        }
+    }
+
+    void add(const math::Vec3& v)
+    {
+        add(v.x);
+        add(v.y);
+        add(v.z);
+    }
+
+    uint64_t value() const { return m_value; }
+
+private:
+    uint64_t m_value = 1469598103934665603ull;
+};
+
+// rifle round through full world, state of every tick folded into hash
+template <typename Body>
+uint64_t runTrajectory(Body body)
+{
+    Simulation simulation(TICK);
+    benchmarks::setupFullWorld(simulation.getWorld());
+
+    body.setVelocityFromAngles(850.0f, 1.5f, 10.0f);
+    const BodyHandle<Body> handle = simulation.spawn<Body>(std::move(body));
+
+    StateHash hash;
+    for (int i = 0; i < TICKS; i++)
+    {
+        simulation.tick();
+
+        Body& state = *simulation.getBodies().get(handle);
+        hash.add(state.getPosition());
+        hash.add(state.getVelocity());
+        if (const IRotationalBody* rotational = state.getRotational())
+        {
+            const math::Quat orientation = rotational->getOrientation();
+            hash.add(orientation.w);
+            hash.add(orientation.x);
+            hash.add(orientation.y);
+            hash.add(orientation.z);
+            hash.add(rotational->getAngularVelocity());
+        }
+    }
+    return hash.value();
+}
+
+} // namespace
+
+TEST(Determinism, RepeatedRunsMatch)
+{
+    EXPECT_EQ(runTrajectory(benchmarks::makeRifleBody()), runTrajectory(benchmarks::makeRifleBody()));
+    EXPECT_EQ(runTrajectory(benchmarks::makeRifleBody6DOF()), runTrajectory(benchmarks::makeRifleBody6DOF()));
+}
+
+TEST(Determinism, Trajectory3DOFMatchesGolden)
+{
+    if (!DETERMINISTIC)
+    {
+        GTEST_SKIP() << "golden hash holds only with BULLET_PHYSICS_DETERMINISTIC";
+    }
+    EXPECT_EQ(runTrajectory(benchmarks::makeRifleBody()), GOLDEN_3DOF);
+}
+
+TEST(Determinism, Trajectory6DOFMatchesGolden)
+{
+    if (!DETERMINISTIC)
+    {
+        GTEST_SKIP() << "golden hash holds only with BULLET_PHYSICS_DETERMINISTIC";
+    }
+    EXPECT_EQ(runTrajectory(benchmarks::makeRifleBody6DOF()), GOLDEN_6DOF);
+}
@@ -0,0 +1,172 @@
+/*
+ * OBBTest.cpp
+ */
+
+#include "collision/BoxCollider.h"
+#include "collision/OBBBatch.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+using namespace BulletPhysics;
+using namespace BulletPhysics::collision;
+
+namespace {
+
+constexpr int PAIRS = 20000;
+constexpr int SAMPLES_PER_EDGE = 5;     // sampled points per box dimension, corners included
+
+class RandomBoxes {
+public:
+    explicit RandomBoxes(uint32_t seed) : m_rng(seed) {}
+
+    // random size and orientation, center within cube of given half width
+    BoxCollider next(float spread)
+    {
+        std::uniform_real_distribution<float> size(0.2f, 3.0f);
+        std::uniform_real_distribution<float> offset(-spread, spread);
+
+        BoxCollider box({size(m_rng), size(m_rng), size(m_rng)});
+        box.setPosition({offset(m_rng), offset(m_rng), offset(m_rng)});
+
+        // orthonormal axes from two random directions
+        const math::Vec3 x = direction();
+        const math::Vec3 y = (direction().cross(x)).normalized();
+        box.setAxes(x, y, x.cross(y));
+        return box;
+    }
+
+private:
+    std::mt19937 m_rng;
+
+    math::Vec3 direction()
+    {
+        std::normal_distribution<float> normal;
+        return math::Vec3{normal(m_rng), normal(m_rng), normal(m_rng)}.normalized();
+    }
+};
+
+// grid of points through volume of box, corners included
+std::vector<math::Vec3> samplePoints(const BoxCollider& box)
+{
+    const math::Vec3* axes = box.getAxes();
+    const math::Vec3 half = box.getSize() * 0.5f;
+
+    std::vector<math::Vec3> points;
+    for (int i = 0; i < SAMPLES_PER_EDGE; i++)
+    {
+        for (int j = 0; j < SAMPLES_PER_EDGE; j++)
+        {
+            for (int k = 0; k < SAMPLES_PER_EDGE; k++)
+            {
+                const float u = 2.0f * static_cast<float>(i) / (SAMPLES_PER_EDGE - 1) - 1.0f;
+                const float v = 2.0f * static_cast<float>(j) / (SAMPLES_PER_EDGE - 1) - 1.0f;
+                const float w = 2.0f * static_cast<float>(k) / (SAMPLES_PER_EDGE - 1) - 1.0f;
+                points.push_back(box.getPosition() + axes[0] * (u * half.x) + axes[1] * (v * half.y) + axes[2] * (w * half.z));
+            }
+        }
+    }
+    return points;
+}
+
+// point of one box found inside the other proves overlap
+bool sampledOverlap(const BoxCollider& a, const BoxCollider& b)
+{
+    for (const math::Vec3& point : samplePoints(a))
+    {
+        if (b.testPoint(point))
+        {
+            return true;
+        }
+    }
+    for (const math::Vec3& point : samplePoints(b))
+    {
+        if (a.testPoint(point))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+// SAT never misses overlap shown by sampled containment, and its normal and depth push boxes apart
+TEST(OBB, SatAgreesWithSampledContainment)
+{
+    RandomBoxes boxes(1234);
+    int overlapping = 0;
+
+    for (int n = 0; n < PAIRS; n++)
+    {
+        const BoxCollider a = boxes.next(2.0f);
+        BoxCollider b = boxes.next(2.0f);
+
+        CollisionInfo info;
+        const bool hit = a.testCollisionWithBox(b, info);
+        if (sampledOverlap(a, b))
+        {
+            ASSERT_TRUE(hit) << "pair " << n;
+            overlapping++;
+        }
+        if (!hit)
+        {
+            continue;
+        }
+
+        ASSERT_GT(info.penetration, 0.0f) << "pair " << n;
+        ASSERT_NEAR(info.normal.length(), 1.0f, 1e-4f) << "pair " << n;
+
+        // moving other box out along normal by reported depth separates them
+        b.setPosition(b.getPosition() + info.normal * (info.penetration + 1e-3f));
+        CollisionInfo separated;
+        EXPECT_FALSE(a.testCollisionWithBox(b, separated)) << "pair " << n;
+        EXPECT_FALSE(sampledOverlap(a, b)) << "pair " << n;
+    }
+
+    // random pairs cover both outcomes
+    EXPECT_GT(overlapping, PAIRS / 10);
+    EXPECT_LT(overlapping, PAIRS);
+}
+
+// batched SAT reports same boxes, depths and normals as one-by-one test
+TEST(OBB, BatchMatchesSinglePair)
+{
+    RandomBoxes boxes(5678);
+
+    std::vector<BoxCollider> targets;
+    OBBBatch batch;
+    for (int i = 0; i < 1000; i++)
+    {
+        targets.push_back(boxes.next(8.0f));
+        batch.add(targets.back());
+    }
+
+    std::vector<OBBBatchHit> hits;
+    for (int q = 0; q < 50; q++)
+    {
+        const BoxCollider query = boxes.next(8.0f);
+        batch.testAgainst(query, hits);
+
+        size_t next = 0;
+        for (size_t i = 0; i < targets.size(); i++)
+        {
+            CollisionInfo info;
+            if (!query.testCollisionWithBox(targets[i], info))
+            {
+                continue;
+            }
+
+            ASSERT_LT(next, hits.size()) << "query " << q << " box " << i;
+            const OBBBatchHit& hit = hits[next++];
+            ASSERT_EQ(hit.index, i) << "query " << q;
+            EXPECT_NEAR(hit.info.penetration, info.penetration, 1e-4f) << "query " << q << " box " << i;
+            EXPECT_NEAR(hit.info.normal.x, info.normal.x, 1e-4f) << "query " << q << " box " << i;
+            EXPECT_NEAR(hit.info.normal.y, info.normal.y, 1e-4f) << "query " << q << " box " << i;
+            EXPECT_NEAR(hit.info.normal.z, info.normal.z, 1e-4f) << "query " << q << " box " << i;
+        }
+        EXPECT_EQ(next, hits.size()) << "query " << q;
+    }
+}
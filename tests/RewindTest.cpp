@@ -0,0 +1,76 @@
+/*
+ * RewindTest.cpp
+ */
+
+#include "dynamics/RewindBuffer.h"
+
+#include <gtest/gtest.h>
+
+using namespace BulletPhysics;
+using namespace BulletPhysics::dynamics;
+
+namespace {
+
+// one body at x = tick, y tells simulation runs apart
+Snapshot makeSnapshot(uint64_t tick, float run)
+{
+    Snapshot snapshot;
+    snapshot.tick = tick;
+
+    BodyRecord record{};
+    record.key = BodyRecord::makeKey(0, 0);
+    record.position = {static_cast<float>(tick), run, 0.0f};
+    snapshot.bodies.push_back(record);
+    return snapshot;
+}
+
+float runAt(RewindBuffer& buffer, uint64_t tick)
+{
+    Snapshot snapshot;
+    EXPECT_TRUE(buffer.get(tick, snapshot)) << "tick " << tick;
+    EXPECT_EQ(snapshot.bodies.size(), 1u);
+    return snapshot.bodies.empty() ? -1.0f : snapshot.bodies[0].position.y;
+}
+
+} // namespace
+
+TEST(Rewind, DeltaTicksDecodeToPushedState)
+{
+    RewindBuffer buffer(30);
+    for (uint64_t tick = 0; tick <= 40; tick++)
+    {
+        buffer.push(makeSnapshot(tick, 0.0f));
+    }
+
+    EXPECT_FALSE(buffer.contains(10));
+    for (uint64_t tick = 11; tick <= 40; tick++)
+    {
+        Snapshot snapshot;
+        ASSERT_TRUE(buffer.get(tick, snapshot));
+        EXPECT_EQ(snapshot.bodies[0].position.x, static_cast<float>(tick));
+    }
+}
+
+// rollback re-simulates and re-pushes ticks, queries must see new run even for tick decoded just before
+TEST(Rewind, RollbackReplacesCachedTick)
+{
+    RewindBuffer buffer(30);
+    for (uint64_t tick = 0; tick <= 20; tick++)
+    {
+        buffer.push(makeSnapshot(tick, 0.0f));
+    }
+    EXPECT_EQ(runAt(buffer, 13), 0.0f);
+
+    buffer.push(makeSnapshot(13, 1.0f));
+    EXPECT_EQ(runAt(buffer, 13), 1.0f);
+    EXPECT_FALSE(buffer.contains(12));
+
+    // re-simulated ticks after rollback, cached one among them
+    for (uint64_t tick = 14; tick <= 20; tick++)
+    {
+        buffer.push(makeSnapshot(tick, 1.0f));
+    }
+    EXPECT_EQ(runAt(buffer, 17), 1.0f);
+    buffer.push(makeSnapshot(17, 2.0f));
+    EXPECT_EQ(runAt(buffer, 17), 2.0f);
+}